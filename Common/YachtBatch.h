@@ -0,0 +1,212 @@
+﻿#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "YachtScoreTable.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define YACHT_BATCH_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC/Clang 은 AVX2 함수에 target 속성이 있어야 /arch 없이도 컴파일된다
+#if defined(YACHT_BATCH_X86) && (defined(__GNUC__) || defined(__clang__))
+#define YACHT_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define YACHT_TARGET_AVX2
+#endif
+
+// =============================================================
+// 일괄 채점 (SoA 버퍼)
+//  - lanes[i][k] = k번째 손패의 i번째 주사위 (1~6)
+//  - out[c * count + k] = k번째 손패의 카테고리 c 점수
+//  - 16개(SSE2) / 32개(AVX2) 손패를 바이트 레인으로 한꺼번에 계산하고
+//    남는 꼬리는 조합 테이블로 처리한다
+// =============================================================
+enum BatchKernel { BATCH_SCALAR, BATCH_SSE2, BATCH_AVX2 };
+
+inline const char* BatchKernelName(BatchKernel k)
+{
+    switch (k)
+    {
+    case BATCH_AVX2: return "avx2";
+    case BATCH_SSE2: return "sse2";
+    default:         return "scalar";
+    }
+}
+
+inline BatchKernel DetectBatchKernel()
+{
+#if defined(YACHT_BATCH_X86)
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7)
+    {
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        __cpuidex(info, 7, 0);
+        bool avx2 = (info[1] & (1 << 5)) != 0;
+        if (osxsave && avx && avx2 && (_xgetbv(0) & 6) == 6)
+            return BATCH_AVX2;
+    }
+    return BATCH_SSE2;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return BATCH_AVX2;
+    return BATCH_SSE2;
+#endif
+#else
+    return BATCH_SCALAR;
+#endif
+}
+
+inline const BatchKernel gBatchKernel = DetectBatchKernel();
+
+inline void ScoreBatchScalar(const uint8_t* const lanes[DICE_COUNT],
+    size_t begin, size_t count, uint8_t* out)
+{
+    for (size_t k = begin; k < count; k++)
+    {
+        uint8_t d[DICE_COUNT];
+        for (int i = 0; i < DICE_COUNT; i++) d[i] = lanes[i][k];
+
+        const uint8_t* s = gHandTable.score[HandIndex(d)];
+        for (int c = 0; c < CATCOUNT; c++)
+            out[c * count + k] = s[c];
+    }
+}
+
+#if defined(YACHT_BATCH_X86)
+
+inline size_t ScoreBatchSSE2(const uint8_t* const lanes[DICE_COUNT], size_t count, uint8_t* out)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi8(-1);
+
+    size_t k = 0;
+    for (; k + 16 <= count; k += 16)
+    {
+        __m128i d[DICE_COUNT];
+        __m128i sum = zero;
+        for (int i = 0; i < DICE_COUNT; i++)
+        {
+            d[i] = _mm_loadu_si128((const __m128i*)(lanes[i] + k));
+            sum = _mm_add_epi8(sum, d[i]);
+        }
+
+        __m128i maxc = zero, distinct = zero;
+        __m128i p[FACE_COUNT + 1];
+        for (int v = 1; v <= FACE_COUNT; v++)
+        {
+            __m128i vv = _mm_set1_epi8((char)v);
+            __m128i cnt = zero, up = zero;
+            for (int i = 0; i < DICE_COUNT; i++)
+            {
+                __m128i eq = _mm_cmpeq_epi8(d[i], vv);
+                cnt = _mm_sub_epi8(cnt, eq);
+                up = _mm_add_epi8(up, _mm_and_si128(eq, vv));
+            }
+            _mm_storeu_si128((__m128i*)(out + (ACES + v - 1) * count + k), up);
+
+            maxc = _mm_max_epu8(maxc, cnt);
+            p[v] = _mm_xor_si128(_mm_cmpeq_epi8(cnt, zero), ones);
+            distinct = _mm_sub_epi8(distinct, p[v]);
+        }
+
+        __m128i four = _mm_cmpgt_epi8(maxc, _mm_set1_epi8(3));
+        __m128i yacht = _mm_cmpeq_epi8(maxc, _mm_set1_epi8(5));
+        __m128i full = _mm_and_si128(_mm_cmpeq_epi8(maxc, _mm_set1_epi8(3)),
+            _mm_cmpeq_epi8(distinct, _mm_set1_epi8(2)));
+
+        __m128i p234 = _mm_and_si128(_mm_and_si128(p[2], p[3]), p[4]);
+        __m128i p2345 = _mm_and_si128(p234, p[5]);
+        __m128i small = _mm_or_si128(_mm_or_si128(_mm_and_si128(p234, p[1]), p2345),
+            _mm_and_si128(_mm_and_si128(p[3], p[4]), _mm_and_si128(p[5], p[6])));
+        __m128i large = _mm_and_si128(p2345, _mm_or_si128(p[1], p[6]));
+
+        _mm_storeu_si128((__m128i*)(out + CHOICE * count + k), sum);
+        _mm_storeu_si128((__m128i*)(out + FOURKIND * count + k), _mm_and_si128(four, sum));
+        _mm_storeu_si128((__m128i*)(out + FULLHOUSE * count + k), _mm_and_si128(full, _mm_set1_epi8(25)));
+        _mm_storeu_si128((__m128i*)(out + SSTRAIGHT * count + k), _mm_and_si128(small, _mm_set1_epi8(30)));
+        _mm_storeu_si128((__m128i*)(out + LSTRAIGHT * count + k), _mm_and_si128(large, _mm_set1_epi8(40)));
+        _mm_storeu_si128((__m128i*)(out + YACHT * count + k), _mm_and_si128(yacht, _mm_set1_epi8(50)));
+    }
+    return k;
+}
+
+YACHT_TARGET_AVX2
+inline size_t ScoreBatchAVX2(const uint8_t* const lanes[DICE_COUNT], size_t count, uint8_t* out)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi8(-1);
+
+    size_t k = 0;
+    for (; k + 32 <= count; k += 32)
+    {
+        __m256i d[DICE_COUNT];
+        __m256i sum = zero;
+        for (int i = 0; i < DICE_COUNT; i++)
+        {
+            d[i] = _mm256_loadu_si256((const __m256i*)(lanes[i] + k));
+            sum = _mm256_add_epi8(sum, d[i]);
+        }
+
+        __m256i maxc = zero, distinct = zero;
+        __m256i p[FACE_COUNT + 1];
+        for (int v = 1; v <= FACE_COUNT; v++)
+        {
+            __m256i vv = _mm256_set1_epi8((char)v);
+            __m256i cnt = zero, up = zero;
+            for (int i = 0; i < DICE_COUNT; i++)
+            {
+                __m256i eq = _mm256_cmpeq_epi8(d[i], vv);
+                cnt = _mm256_sub_epi8(cnt, eq);
+                up = _mm256_add_epi8(up, _mm256_and_si256(eq, vv));
+            }
+            _mm256_storeu_si256((__m256i*)(out + (ACES + v - 1) * count + k), up);
+
+            maxc = _mm256_max_epu8(maxc, cnt);
+            p[v] = _mm256_xor_si256(_mm256_cmpeq_epi8(cnt, zero), ones);
+            distinct = _mm256_sub_epi8(distinct, p[v]);
+        }
+
+        __m256i four = _mm256_cmpgt_epi8(maxc, _mm256_set1_epi8(3));
+        __m256i yacht = _mm256_cmpeq_epi8(maxc, _mm256_set1_epi8(5));
+        __m256i full = _mm256_and_si256(_mm256_cmpeq_epi8(maxc, _mm256_set1_epi8(3)),
+            _mm256_cmpeq_epi8(distinct, _mm256_set1_epi8(2)));
+
+        __m256i p234 = _mm256_and_si256(_mm256_and_si256(p[2], p[3]), p[4]);
+        __m256i p2345 = _mm256_and_si256(p234, p[5]);
+        __m256i small = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(p234, p[1]), p2345),
+            _mm256_and_si256(_mm256_and_si256(p[3], p[4]), _mm256_and_si256(p[5], p[6])));
+        __m256i large = _mm256_and_si256(p2345, _mm256_or_si256(p[1], p[6]));
+
+        _mm256_storeu_si256((__m256i*)(out + CHOICE * count + k), sum);
+        _mm256_storeu_si256((__m256i*)(out + FOURKIND * count + k), _mm256_and_si256(four, sum));
+        _mm256_storeu_si256((__m256i*)(out + FULLHOUSE * count + k), _mm256_and_si256(full, _mm256_set1_epi8(25)));
+        _mm256_storeu_si256((__m256i*)(out + SSTRAIGHT * count + k), _mm256_and_si256(small, _mm256_set1_epi8(30)));
+        _mm256_storeu_si256((__m256i*)(out + LSTRAIGHT * count + k), _mm256_and_si256(large, _mm256_set1_epi8(40)));
+        _mm256_storeu_si256((__m256i*)(out + YACHT * count + k), _mm256_and_si256(yacht, _mm256_set1_epi8(50)));
+    }
+    return k;
+}
+
+#endif
+
+inline void ScoreBatch(const uint8_t* const lanes[DICE_COUNT], size_t count, uint8_t* out,
+    BatchKernel kernel = gBatchKernel)
+{
+    size_t done = 0;
+#if defined(YACHT_BATCH_X86)
+    if (kernel == BATCH_AVX2) done = ScoreBatchAVX2(lanes, count, out);
+    else if (kernel == BATCH_SSE2) done = ScoreBatchSSE2(lanes, count, out);
+#else
+    (void)kernel;
+#endif
+    ScoreBatchScalar(lanes, done, count, out);
+}
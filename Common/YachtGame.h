@@ -0,0 +1,192 @@
+﻿#pragma once
+#include <cstdint>
+
+#include "YachtRng.h"
+#include "YachtRules.h"
+
+// =============================================================
+// 헤드리스 게임 상태 (창 / GLUT 없이 동작하는 값 타입)
+//  - 게임 한 판의 모든 상태 = 주사위, 고정 비트, 굴린 횟수, 점수판, 난수 위치
+//  - Apply(action) 는 자신을 바꾸지 않고 다음 상태를 돌려준다
+//  - 난수는 Philox (seed, 난수 사용 번호) 로 뽑으므로 같은 상태 + 같은 행동
+//    => 항상 같은 결과 (상태를 복사해 두고 여러 갈래로 진행해도 된다)
+//
+//  턴 규칙 (GL 게임과 같음)
+//  - 턴 시작 시 주사위 5개를 새로 나눠 준다 (굴린 횟수 0)
+//  - 이후 고정하지 않은 주사위를 최대 MAX_ROLLS 번 다시 굴릴 수 있다
+//  - 카테고리를 기록하면 고정이 풀리고 다음 턴
+// =============================================================
+enum ActionType : uint8_t
+{
+    ACTION_HOLD,     // arg = 주사위 위치 (고정 토글)
+    ACTION_ROLL,
+    ACTION_RECORD,   // arg = CategoryType
+};
+
+struct Action
+{
+    ActionType type;
+    uint8_t    arg;
+};
+
+inline Action HoldAction(int die) { return { ACTION_HOLD, (uint8_t)die }; }
+inline Action RollAction() { return { ACTION_ROLL, 0 }; }
+inline Action RecordAction(CategoryType cat) { return { ACTION_RECORD, (uint8_t)cat }; }
+
+struct GameState
+{
+    DiceHand  dice;
+    uint8_t   holdMask = 0;    // bit i = i번 주사위 고정
+    uint8_t   rollCount = 0;   // 이번 턴에 다시 굴린 횟수
+    ScoreCard card;
+    uint64_t  seed = 0;
+    uint32_t  draws = 0;       // 지금까지 주사위를 뽑은 횟수 (Philox 스트림 번호)
+
+    // 첫 턴 주사위까지 나눠 준 새 게임
+    static GameState New(uint64_t seed)
+    {
+        GameState s;
+        s.seed = seed;
+        s.Draw();
+        return s;
+    }
+
+    bool IsHeld(int die) const { return (holdMask >> die) & 1; }
+    bool IsOver() const { return card.IsFull(); }
+
+    // 지금까지 기록한 카테고리 수 (0 ~ TURN_COUNT)
+    int Turn() const
+    {
+        int n = 0;
+        for (int c = 0; c < CATCOUNT; c++) n += card.IsUsed(c);
+        return n;
+    }
+
+    bool IsLegal(const Action& a) const
+    {
+        if (IsOver()) return false;
+        switch (a.type)
+        {
+        case ACTION_HOLD:   return a.arg < DICE_COUNT;
+        case ACTION_ROLL:   return rollCount < MAX_ROLLS;
+        case ACTION_RECORD: return a.arg < CATCOUNT && !card.IsUsed(a.arg);
+        }
+        return false;
+    }
+
+    // 허용되지 않는 행동이면 상태를 그대로 돌려준다
+    GameState Apply(const Action& a) const
+    {
+        GameState s = *this;
+        if (!IsLegal(a)) return s;
+
+        switch (a.type)
+        {
+        case ACTION_HOLD:
+            s.holdMask ^= (uint8_t)(1u << a.arg);
+            break;
+
+        case ACTION_ROLL:
+            s.Draw();
+            s.rollCount++;
+            break;
+
+        case ACTION_RECORD:
+            s.card.Record((CategoryType)a.arg, s.dice);
+            s.holdMask = 0;
+            s.rollCount = 0;
+            if (!s.IsOver()) s.Draw();
+            break;
+        }
+        return s;
+    }
+
+private:
+    // 고정하지 않은 주사위를 새로 뽑는다
+    void Draw()
+    {
+        D6Sampler<Philox4x32> d6(Philox4x32(seed, draws++));
+        for (int i = 0; i < DICE_COUNT; i++)
+            if (!IsHeld(i)) dice.value[i] = (uint8_t)d6();
+    }
+};
+
+// =============================================================
+// 64비트 상태 코드 (캐시 키 / 리플레이 / 네트워크 메시지용)
+//  - 상태와 코드가 1:1 (같은 상태면 항상 같은 코드)
+//  - 난수 위치(seed, draws)는 규칙 상태가 아니므로 넣지 않는다
+//
+//  비트   내용
+//  0-12   주사위 5개 (6진수 d0 + 6 d1 + ..., 7776 < 2^13)
+//  13-17  고정 비트
+//  18-19  굴린 횟수
+//  20-31  기록한 카테고리 비트
+//  32-49  ACES~SIXES 점수 / 눈 값 (0~5, 3비트씩)
+//  50-54  CHOICE (0~30)
+//  55-59  FOURKIND (0~30)
+//  60-63  FULLHOUSE, SSTRAIGHT, LSTRAIGHT, YACHT 득점 여부
+// =============================================================
+inline uint64_t PackState(const GameState& s)
+{
+    uint64_t dice = 0;
+    for (int i = DICE_COUNT - 1; i >= 0; i--) dice = dice * 6 + (s.dice.value[i] - 1);
+
+    uint64_t code = dice
+        | (uint64_t)s.holdMask << 13
+        | (uint64_t)s.rollCount << 18
+        | (uint64_t)s.card.usedMask << 20;
+    // 나눗셈 대신 역수 곱 (점수 <= 30 에서 정확)
+    static const uint32_t recip[6] = { 65536, 32768, 21846, 16384, 13108, 10923 };
+    for (int c = ACES; c <= SIXES; c++)
+        code |= (uint64_t)((s.card.score[c] * recip[c]) >> 16) << (32 + 3 * c);
+    code |= (uint64_t)s.card.score[CHOICE] << 50;
+    code |= (uint64_t)s.card.score[FOURKIND] << 55;
+    for (int c = FULLHOUSE; c <= YACHT; c++)
+        code |= (uint64_t)(s.card.score[c] != 0) << (60 + c - FULLHOUSE);
+    return code;
+}
+
+// 범위를 벗어난 코드면 false (네트워크로 받은 값 검사용)
+inline bool UnpackState(uint64_t code, GameState& s, uint64_t seed = 0, uint32_t draws = 0)
+{
+    static const int16_t fixedScore[4] = { 25, 30, 40, 50 };
+
+    uint32_t dice = code & 0x1FFF;
+    int rollCount = (code >> 18) & 3;
+    if (dice >= RAW_HAND_COUNT || rollCount > MAX_ROLLS) return false;
+
+    GameState r;
+    for (int i = 0; i < DICE_COUNT; i++) { r.dice.value[i] = (uint8_t)(dice % 6 + 1); dice /= 6; }
+    r.holdMask = (uint8_t)((code >> 13) & 0x1F);
+    r.rollCount = (uint8_t)rollCount;
+    r.card.usedMask = (uint16_t)((code >> 20) & 0xFFF);
+
+    for (int c = ACES; c <= SIXES; c++)
+    {
+        int n = (code >> (32 + 3 * c)) & 7;
+        if (n > DICE_COUNT) return false;
+        r.card.score[c] = (int16_t)(n * (c + 1));
+    }
+    r.card.score[CHOICE] = (int16_t)((code >> 50) & 0x1F);
+    r.card.score[FOURKIND] = (int16_t)((code >> 55) & 0x1F);
+    if (r.card.score[CHOICE] > 30 || r.card.score[FOURKIND] > 30) return false;
+    for (int c = FULLHOUSE; c <= YACHT; c++)
+        r.card.score[c] = ((code >> (60 + c - FULLHOUSE)) & 1) ? fixedScore[c - FULLHOUSE] : 0;
+
+    // 기록하지 않은 카테고리에 점수가 있으면 잘못된 코드
+    for (int c = 0; c < CATCOUNT; c++)
+        if (!r.card.IsUsed(c) && r.card.score[c] != 0) return false;
+
+    r.seed = seed;
+    r.draws = draws;
+    s = r;
+    return true;
+}
+
+// 해시 테이블용 (코드 비트를 고르게 섞는다, SplitMix64 마무리 단계)
+inline uint64_t HashState(uint64_t code)
+{
+    code = (code ^ (code >> 30)) * 0xBF58476D1CE4E5B9ull;
+    code = (code ^ (code >> 27)) * 0x94D049BB133111EBull;
+    return code ^ (code >> 31);
+}
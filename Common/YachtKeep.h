@@ -0,0 +1,225 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "YachtScoreTable.h"
+
+// =============================================================
+// 고정(keep) 조합 테이블
+//  - 다시 굴리기 전에 남겨 둘 주사위 0~5개의 중복조합 = C(11,5) = 462가지
+//  - 크기 순으로 번호를 매겨, 주사위를 하나 더한 조합(child)은
+//    항상 더 큰 번호가 된다 => 뒤에서부터 한 번만 훑으면 기댓값 계산 가능
+//  - 손패마다 32가지 고정 방법 중 서로 다른 조합만 모아 둔다
+// =============================================================
+constexpr int KEEP_COUNT = 462;
+constexpr int HOLD_MASKS = 1 << DICE_COUNT;
+
+struct KeepTable
+{
+    uint8_t counts[KEEP_COUNT][FACE_COUNT + 1];  // counts[v] (0번 미사용)
+    uint8_t size[KEEP_COUNT];
+    int16_t child[KEEP_COUNT][FACE_COUNT + 1];   // 눈 v 하나 추가 (size 5면 -1)
+    int16_t handOf[KEEP_COUNT];                  // size 5 조합 -> 손패 번호 (아니면 -1)
+
+    uint8_t holdCount[HAND_COUNT];               // 손패별 서로 다른 고정 조합 수
+    int16_t holdKeep[HAND_COUNT][HOLD_MASKS];
+    uint8_t holdMask[HAND_COUNT][HOLD_MASKS];    // 정렬된 눈 기준 고정 비트
+
+    float   handProb[HAND_COUNT];                // 주사위 5개를 새로 굴렸을 때 확률
+};
+
+inline int KeepKey(const uint8_t c[FACE_COUNT + 1])
+{
+    int key = 0;
+    for (int v = FACE_COUNT; v >= 1; v--) key = key * 6 + c[v];
+    return key;
+}
+
+inline KeepTable BuildKeepTable()
+{
+    KeepTable t{};
+    std::vector<int16_t> byKey(6 * 6 * 6 * 6 * 6 * 6, -1);
+
+    // 크기 0~5 순서로 오름차순 조합 나열
+    int n = 0;
+    for (int sz = 0; sz <= DICE_COUNT; sz++)
+    {
+        int s[DICE_COUNT] = { 1, 1, 1, 1, 1 };
+        while (true)
+        {
+            uint8_t* c = t.counts[n];
+            for (int i = 0; i < sz; i++) c[s[i]]++;
+            t.size[n] = (uint8_t)sz;
+            byKey[KeepKey(c)] = (int16_t)n;
+            n++;
+
+            // 다음 비내림차순 수열
+            int i = sz - 1;
+            while (i >= 0 && s[i] == FACE_COUNT) i--;
+            if (i < 0) break;
+            s[i]++;
+            for (int j = i + 1; j < sz; j++) s[j] = s[i];
+        }
+    }
+
+    for (int k = 0; k < KEEP_COUNT; k++)
+    {
+        t.handOf[k] = -1;
+        for (int v = 0; v <= FACE_COUNT; v++) t.child[k][v] = -1;
+
+        if (t.size[k] == DICE_COUNT)
+        {
+            int d[DICE_COUNT], m = 0;
+            for (int v = 1; v <= FACE_COUNT; v++)
+                for (int j = 0; j < t.counts[k][v]; j++) d[m++] = v;
+            t.handOf[k] = (int16_t)HandIndex(d);
+            continue;
+        }
+        for (int v = 1; v <= FACE_COUNT; v++)
+        {
+            uint8_t c[FACE_COUNT + 1];
+            for (int u = 0; u <= FACE_COUNT; u++) c[u] = t.counts[k][u];
+            c[v]++;
+            t.child[k][v] = byKey[KeepKey(c)];
+        }
+    }
+
+    for (int h = 0; h < HAND_COUNT; h++)
+    {
+        // 32가지 고정 비트 중 같은 조합은 하나만
+        for (int m = 0; m < HOLD_MASKS; m++)
+        {
+            uint8_t c[FACE_COUNT + 1] = {};
+            for (int i = 0; i < DICE_COUNT; i++)
+                if (m & (1 << i)) c[gHandTable.faces[h][i]]++;
+
+            int16_t k = byKey[KeepKey(c)];
+            bool dup = false;
+            for (int j = 0; j < t.holdCount[h]; j++)
+                if (t.holdKeep[h][j] == k) dup = true;
+            if (dup) continue;
+
+            t.holdKeep[h][t.holdCount[h]] = k;
+            t.holdMask[h][t.holdCount[h]] = (uint8_t)m;
+            t.holdCount[h]++;
+        }
+
+        // 다항 계수 5! / (c1! ... c6!) / 6^5
+        static const int fact[DICE_COUNT + 1] = { 1, 1, 2, 6, 24, 120 };
+        int ways = fact[DICE_COUNT];
+        for (int v = 1; v <= FACE_COUNT; v++) ways /= fact[gHandTable.counts[h][v]];
+        t.handProb[h] = (float)ways / RAW_HAND_COUNT;
+    }
+    return t;
+}
+
+inline const KeepTable& GetKeepTable()
+{
+    static const KeepTable table = BuildKeepTable();
+    return table;
+}
+
+// =============================================================
+// 고정 조합 -> 다시 굴린 결과 손패 전이 (CSR 희소 행렬)
+//  - 행 = 고정 조합 462개, 열 = 결과 손패 252개, 값 = 정확한 확률
+//  - 고정 k 개를 남기면 (5-k) 개를 굴린 결과의 중복조합 수만큼 칸이 있다 (총 4368칸)
+// =============================================================
+struct KeepTransitions
+{
+    std::vector<uint32_t> rowStart;   // [KEEP_COUNT + 1]
+    std::vector<uint16_t> hand;       // 결과 손패 번호
+    std::vector<float>    prob;
+    std::vector<int16_t>  keepByKey;  // KeepKey(counts) -> 고정 조합 번호
+    float score[HAND_COUNT][CATCOUNT];  // 점수 테이블의 float 사본 (곱셈-누적용)
+
+    int KeepOf(const uint8_t c[FACE_COUNT + 1]) const { return keepByKey[KeepKey(c)]; }
+
+    // 고정 조합 keep 을 남기고 굴렸을 때 handValue 의 기댓값
+    float Expect(int keep, const float* handValue) const
+    {
+        float e = 0.0f;
+        for (uint32_t i = rowStart[keep]; i < rowStart[keep + 1]; i++)
+            e += prob[i] * handValue[hand[i]];
+        return e;
+    }
+};
+
+inline KeepTransitions BuildKeepTransitions()
+{
+    const KeepTable& kt = GetKeepTable();
+    static const int fact[DICE_COUNT + 1] = { 1, 1, 2, 6, 24, 120 };
+    static const int pow6[DICE_COUNT + 1] = { 1, 6, 36, 216, 1296, 7776 };
+
+    KeepTransitions t;
+    t.keepByKey.assign(6 * 6 * 6 * 6 * 6 * 6, -1);
+    for (int k = 0; k < KEEP_COUNT; k++) t.keepByKey[KeepKey(kt.counts[k])] = (int16_t)k;
+    for (int h = 0; h < HAND_COUNT; h++)
+        for (int c = 0; c < CATCOUNT; c++) t.score[h][c] = gHandTable.score[h][c];
+
+    t.rowStart.push_back(0);
+    for (int k = 0; k < KEEP_COUNT; k++)
+    {
+        int roll = DICE_COUNT - kt.size[k];
+
+        // 굴리는 주사위의 결과 = 크기 roll 인 고정 조합과 같은 모양
+        for (int o = 0; o < KEEP_COUNT; o++)
+        {
+            if (kt.size[o] != roll) continue;
+
+            int ways = fact[roll];
+            uint8_t c[FACE_COUNT + 1] = {};
+            for (int v = 1; v <= FACE_COUNT; v++)
+            {
+                ways /= fact[kt.counts[o][v]];
+                c[v] = (uint8_t)(kt.counts[k][v] + kt.counts[o][v]);
+            }
+            t.hand.push_back((uint16_t)kt.handOf[t.KeepOf(c)]);
+            t.prob.push_back((float)ways / pow6[roll]);
+        }
+        t.rowStart.push_back((uint32_t)t.hand.size());
+    }
+    return t;
+}
+
+inline const KeepTransitions& GetKeepTransitions()
+{
+    static const KeepTransitions table = BuildKeepTransitions();
+    return table;
+}
+
+// =============================================================
+// 한 번 더 굴릴 때 32가지 고정 비트(실제 주사위 위치) 각각의
+// 카테고리별 기대 점수를 한 번에 계산
+//  - 서로 다른 고정 조합만 계산하고 같은 조합인 비트에는 복사
+// =============================================================
+inline void ExpectedCategoryScores(const uint8_t dice[DICE_COUNT], float out[HOLD_MASKS][CATCOUNT])
+{
+    const KeepTransitions& tr = GetKeepTransitions();
+
+    int16_t done[KEEP_COUNT];
+    for (int k = 0; k < KEEP_COUNT; k++) done[k] = -1;
+
+    for (int m = 0; m < HOLD_MASKS; m++)
+    {
+        uint8_t c[FACE_COUNT + 1] = {};
+        for (int i = 0; i < DICE_COUNT; i++)
+            if (m & (1 << i)) c[dice[i]]++;
+        int keep = tr.KeepOf(c);
+
+        if (done[keep] >= 0)
+        {
+            for (int cat = 0; cat < CATCOUNT; cat++) out[m][cat] = out[done[keep]][cat];
+            continue;
+        }
+        done[keep] = (int16_t)m;
+
+        float e[CATCOUNT] = {};
+        for (uint32_t i = tr.rowStart[keep]; i < tr.rowStart[keep + 1]; i++)
+        {
+            const float* s = tr.score[tr.hand[i]];
+            float p = tr.prob[i];
+            for (int cat = 0; cat < CATCOUNT; cat++) e[cat] += p * s[cat];
+        }
+        for (int cat = 0; cat < CATCOUNT; cat++) out[m][cat] = e[cat];
+    }
+}
@@ -0,0 +1,205 @@
+﻿#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// =============================================================
+// 읽기 전용 메모리 매핑 파일
+//  - 여러 프로세스가 같은 파일을 열면 페이지 캐시를 그대로 공유한다
+//  - 복사 불가, 이동만 가능
+// =============================================================
+struct MappedFile
+{
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& o) noexcept { *this = static_cast<MappedFile&&>(o); }
+    MappedFile& operator=(MappedFile&& o) noexcept
+    {
+        if (this != &o)
+        {
+            Close();
+            data = o.data; size = o.size;
+            o.data = nullptr; o.size = 0;
+        }
+        return *this;
+    }
+    ~MappedFile() { Close(); }
+
+    bool Open(const char* path)
+    {
+        Close();
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER len;
+        if (!GetFileSizeEx(file, &len) || len.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping) return false;
+
+        void* p = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!p) return false;
+
+        data = (const uint8_t*)p;
+        size = (size_t)len.QuadPart;
+#else
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            close(fd);
+            return false;
+        }
+        void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (p == MAP_FAILED) return false;
+
+        data = (const uint8_t*)p;
+        size = (size_t)st.st_size;
+#endif
+        return true;
+    }
+
+    void Close()
+    {
+        if (!data) return;
+#if defined(_WIN32)
+        UnmapViewOfFile(data);
+#else
+        munmap((void*)data, size);
+#endif
+        data = nullptr;
+        size = 0;
+    }
+
+    bool IsOpen() const { return data != nullptr; }
+};
+
+// FNV-1a 64비트 (파일 무결성 확인용)
+inline uint64_t Fnv1a64(const void* data, size_t size, uint64_t h = 14695981039346656037ull)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < size; i++)
+    {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// 파일 안 배열 시작 위치 정렬용
+inline size_t AlignUp(size_t x, size_t a) { return (x + a - 1) / a * a; }
+
+// =============================================================
+// 캐시 파일이 원본과 맞는지 확인용
+// =============================================================
+
+// 원본 크기 / 수정 시각 (없으면 false)
+inline bool SourceStamp(const char* path, uint64_t& size, int64_t& time)
+{
+    std::error_code ec;
+    auto sz = std::filesystem::file_size(path, ec);
+    if (ec) return false;
+    auto tm = std::filesystem::last_write_time(path, ec);
+    if (ec) return false;
+    size = (uint64_t)sz;
+    time = (int64_t)tm.time_since_epoch().count();
+    return true;
+}
+
+// 원본 전체 FNV-1a (못 열면 0)
+inline uint64_t SourceHash(const char* path)
+{
+    MappedFile src;
+    if (!src.Open(path)) return 0;
+    return Fnv1a64(src.data, src.size);
+}
+
+// 캐시에 적힌 원본 정보와 맞는지. 크기 + 시각이 같으면 바로 통과,
+// 시각만 다르면 내용 해시로 확인. 원본이 없으면 (캐시만 배포) 통과
+//  - 해시로 통과했으면 time 을 원본의 지금 시각으로 바꾸고 restamp = true
+//    => 호출한 쪽이 캐시 헤더를 다시 적어 두면 다음 실행부터는 해시를 안 한다
+inline bool SourceMatches(const char* path, uint64_t size, int64_t& time, uint64_t hash, bool& restamp)
+{
+    restamp = false;
+    uint64_t sz;
+    int64_t tm;
+    if (!path || !SourceStamp(path, sz, tm)) return true;
+    if (sz != size) return false;
+    if (tm == time) return true;
+    if (SourceHash(path) != hash) return false;
+    time = tm;
+    restamp = true;
+    return true;
+}
+
+// 캐시 파일 맨 앞의 헤더만 제자리에서 다시 쓴다 (읽기 전용 위치면 실패, 캐시는 그대로 쓸 수 있다)
+template <class Header>
+inline bool RewriteHeader(const char* path, const Header& hdr)
+{
+    std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!f.is_open()) return false;
+    f.write((const char*)&hdr, sizeof(hdr));
+    f.close();
+    return !f.fail();
+}
+
+// 캐시 파일을 만들 때 쓰는 임시 파일 이름 ("<path>.<pid>.<n>.tmp")
+//  - 같은 캐시를 여러 프로세스 / 스레드가 동시에 만들어도 서로의 임시 파일을 덮어쓰지 않는다
+inline std::string TempPathFor(const char* path)
+{
+    static std::atomic<uint32_t> serial{ 0 };
+#if defined(_WIN32)
+    unsigned long pid = GetCurrentProcessId();
+#else
+    unsigned long pid = (unsigned long)getpid();
+#endif
+    return std::string(path) + "." + std::to_string(pid) + "." + std::to_string(serial++) + ".tmp";
+}
+
+// 임시 파일에 다 쓴 뒤 닫고 제 이름으로 바꾼다 (반쪽 파일이 남지 않게)
+//  - 쓰기 / 닫기 / 이름 바꾸기 중 하나라도 실패하면 임시 파일을 지우고 false
+inline bool CommitTempFile(std::ofstream& f, const std::string& tmp, const char* path)
+{
+    f.close();
+    std::error_code ec;
+    if (!f.fail())
+    {
+        std::filesystem::rename(tmp, path, ec);
+        if (!ec) return true;
+    }
+    std::filesystem::remove(tmp, ec);
+    return false;
+}
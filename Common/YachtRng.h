@@ -0,0 +1,151 @@
+﻿#pragma once
+#include <cstdint>
+#include <limits>
+
+// =============================================================
+// 난수 생성기
+//  - 둘 다 UniformRandomBitGenerator 요건을 만족하므로 std 분포에도 쓸 수 있다
+//  - (seed, stream) 으로 서로 독립인 스트림을 바로 만든다
+//
+//  Xoshiro256pp : 가장 빠른 순차 생성기 (SplitMix64 로 상태 초기화)
+//  Philox4x32   : 카운터 기반 (key = seed, counter = stream:index)
+//                 스트림끼리 절대 겹치지 않고 임의 위치로 바로 이동 가능
+// =============================================================
+inline uint64_t SplitMix64(uint64_t& x)
+{
+    uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+struct Xoshiro256pp
+{
+    using result_type = uint64_t;
+    uint64_t s[4];
+
+    explicit Xoshiro256pp(uint64_t seed = 1, uint64_t stream = 0)
+    {
+        uint64_t x = seed ^ SplitMix64(stream);
+        for (uint64_t& w : s) w = SplitMix64(x);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<uint64_t>::max(); }
+
+    static uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    result_type operator()()
+    {
+        uint64_t r = Rotl(s[0] + s[3], 23) + s[0];
+        uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = Rotl(s[3], 45);
+        return r;
+    }
+};
+
+struct Philox4x32
+{
+    using result_type = uint64_t;
+    uint32_t key[2];
+    uint32_t ctr[4];      // ctr[0..1] = 블록 번호, ctr[2..3] = 스트림
+    uint32_t out[4];
+    int      used = 4;    // out 에서 꺼낸 32비트 워드 수
+
+    explicit Philox4x32(uint64_t seed = 1, uint64_t stream = 0)
+    {
+        key[0] = (uint32_t)seed; key[1] = (uint32_t)(seed >> 32);
+        ctr[0] = 0; ctr[1] = 0;
+        ctr[2] = (uint32_t)stream; ctr[3] = (uint32_t)(stream >> 32);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<uint64_t>::max(); }
+
+    // 스트림 안의 블록 위치로 이동 (블록 하나 = 128비트)
+    void Seek(uint64_t block)
+    {
+        ctr[0] = (uint32_t)block; ctr[1] = (uint32_t)(block >> 32);
+        used = 4;
+    }
+
+    static void Round(uint32_t c[4], const uint32_t k[2])
+    {
+        uint64_t p0 = (uint64_t)0xD2511F53u * c[0];
+        uint64_t p1 = (uint64_t)0xCD9E8D57u * c[2];
+        uint32_t n0 = (uint32_t)(p1 >> 32) ^ c[1] ^ k[0];
+        uint32_t n2 = (uint32_t)(p0 >> 32) ^ c[3] ^ k[1];
+        c[0] = n0; c[1] = (uint32_t)p1;
+        c[2] = n2; c[3] = (uint32_t)p0;
+    }
+
+    void Generate()
+    {
+        uint32_t c[4] = { ctr[0], ctr[1], ctr[2], ctr[3] };
+        uint32_t k[2] = { key[0], key[1] };
+        for (int r = 0; r < 10; r++)
+        {
+            Round(c, k);
+            k[0] += 0x9E3779B9u;
+            k[1] += 0xBB67AE85u;
+        }
+        for (int i = 0; i < 4; i++) out[i] = c[i];
+        if (++ctr[0] == 0) ++ctr[1];
+        used = 0;
+    }
+
+    result_type operator()()
+    {
+        if (used > 2) Generate();
+        uint64_t r = ((uint64_t)out[used + 1] << 32) | out[used];
+        used += 2;
+        return r;
+    }
+};
+
+// =============================================================
+// 주사위(d6) 묶음 샘플러
+//  - 64비트 난수 하나로 주사위 21개 (6^21 < 2^64)
+//  - 6^21 의 배수 범위를 벗어난 값은 버리므로 편향 없음 (버릴 확률 약 0.107%)
+// =============================================================
+template <class Rng>
+struct D6Sampler
+{
+    static constexpr int      PER_DRAW = 21;
+    static constexpr uint64_t RANGE = 21936950640377856ull;   // 6^21
+    static constexpr uint64_t LIMIT = (std::numeric_limits<uint64_t>::max() / RANGE) * RANGE;
+
+    Rng      rng;
+    uint64_t pool = 0;
+    int      left = 0;
+
+    explicit D6Sampler(const Rng& r = Rng()) : rng(r) {}
+
+    int operator()()
+    {
+        if (left == 0)
+        {
+            uint64_t x;
+            do { x = rng(); } while (x >= LIMIT);
+            pool = x % RANGE;
+            left = PER_DRAW;
+        }
+        int d = (int)(pool % 6);
+        pool /= 6;
+        left--;
+        return d + 1;
+    }
+
+    void Fill(uint8_t* out, int n)
+    {
+        for (int i = 0; i < n; i++) out[i] = (uint8_t)(*this)();
+    }
+};
+
+static_assert(D6Sampler<Xoshiro256pp>::RANGE == 6ull * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6 * 6,
+    "RANGE must be 6^21");
@@ -0,0 +1,66 @@
+﻿#pragma once
+#include <cstdint>
+
+#include "YachtScoreTable.h"
+
+// =============================================================
+// 요트 다이스 규칙 (게임 / 콘솔 공용, 헤더 전용, 동적 할당 없음)
+// =============================================================
+
+inline constexpr const char* CATEGORY_NAMES[CATCOUNT] = {
+    "Aces", "Deuces", "Threes", "Fours", "Fives", "Sixes",
+    "Choice", "4 of a Kind", "Full House", "S. Straight", "L. Straight", "Yacht"
+};
+
+constexpr int TURN_COUNT = CATCOUNT;
+constexpr int MAX_ROLLS = 3;
+
+// =============================================================
+// 주사위 5개 (값 타입)
+// =============================================================
+struct DiceHand
+{
+    uint8_t value[DICE_COUNT] = { 1, 1, 1, 1, 1 };
+
+    int Index() const { return HandIndex(value); }
+
+    int Sum() const
+    {
+        int s = 0;
+        for (int i = 0; i < DICE_COUNT; i++) s += value[i];
+        return s;
+    }
+};
+
+inline int Score(const DiceHand& hand, CategoryType cat)
+{
+    return HandScore(hand.Index(), cat);
+}
+
+// =============================================================
+// 점수판
+// =============================================================
+struct ScoreCard
+{
+    int16_t  score[CATCOUNT] = {};
+    uint16_t usedMask = 0;   // bit c = 카테고리 c 기록 여부
+
+    bool IsUsed(int cat) const { return (usedMask >> cat) & 1; }
+    bool IsFull() const { return usedMask == (1u << CATCOUNT) - 1; }
+
+    // 이미 기록한 카테고리면 false
+    bool Record(CategoryType cat, const DiceHand& hand)
+    {
+        if (IsUsed(cat)) return false;
+        score[cat] = (int16_t)Score(hand, cat);
+        usedMask |= (uint16_t)(1u << cat);
+        return true;
+    }
+
+    int Total() const
+    {
+        int s = 0;
+        for (int i = 0; i < CATCOUNT; i++) s += score[i];
+        return s;
+    }
+};
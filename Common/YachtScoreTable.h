@@ -0,0 +1,142 @@
+﻿#pragma once
+#include <cstdint>
+
+// =============================================================
+// 카테고리
+// =============================================================
+enum CategoryType {
+    ACES, DEUCES, THREES, FOURS, FIVES, SIXES,
+    CHOICE, FOURKIND, FULLHOUSE,
+    SSTRAIGHT, LSTRAIGHT, YACHT,
+    CATCOUNT
+};
+
+// =============================================================
+// 주사위 조합 점수 테이블
+//  - 주사위 5개를 정렬하면 중복조합 6H5 = 252가지뿐이므로
+//    각 조합에 0~251 번호를 붙이고 12개 카테고리 점수를
+//    컴파일 타임에 미리 계산해 둔다
+//  - 순서 있는 주사위 값(6^5 = 7776가지) -> 조합 번호 표도 함께 만들어
+//    실행 중에는 정렬/히스토그램 없이 표 두 번만 조회하면 된다
+// =============================================================
+constexpr int DICE_COUNT = 5;
+constexpr int FACE_COUNT = 6;
+constexpr int HAND_COUNT = 252;
+constexpr int RAW_HAND_COUNT = 7776;
+
+struct HandTable
+{
+    uint8_t faces[HAND_COUNT][DICE_COUNT];      // 오름차순 눈 (1~6)
+    uint8_t counts[HAND_COUNT][FACE_COUNT + 1]; // counts[v] = 눈 v의 개수 (0번 미사용)
+    uint8_t score[HAND_COUNT][CATCOUNT];
+    uint8_t index[RAW_HAND_COUNT];              // 순서 있는 주사위 -> 조합 번호
+};
+
+constexpr int Binomial(int n, int k)
+{
+    if (k < 0 || k > n) return 0;
+    int r = 1;
+    for (int i = 1; i <= k; i++)
+        r = r * (n - k + i) / i;
+    return r;
+}
+
+// 정렬된 눈(0~5) s[0] <= ... <= s[4] 를 조합 번호로 변환
+//  - t[i] = s[i] + i 는 0~9 중 서로 다른 5개 => C(10,5) = 252
+//  - 조합 수 체계(combinatorial number system)로 순위를 매긴다
+constexpr int RankSorted(const int s[DICE_COUNT])
+{
+    int r = 0;
+    for (int i = 0; i < DICE_COUNT; i++)
+        r += Binomial(s[i] + i, i + 1);
+    return r;
+}
+
+constexpr void ScoreHand(const uint8_t c[FACE_COUNT + 1], uint8_t out[CATCOUNT])
+{
+    int sum = 0;
+    bool four = false, three = false, two = false, yacht = false;
+    for (int v = 1; v <= FACE_COUNT; v++)
+    {
+        sum += c[v] * v;
+        out[ACES + v - 1] = (uint8_t)(c[v] * v);
+        if (c[v] >= 4) four = true;
+        if (c[v] == 5) yacht = true;
+        if (c[v] == 3) three = true;
+        if (c[v] == 2) two = true;
+    }
+
+    bool s1 = c[1] && c[2] && c[3] && c[4];
+    bool s2 = c[2] && c[3] && c[4] && c[5];
+    bool s3 = c[3] && c[4] && c[5] && c[6];
+    bool l1 = s1 && c[5];
+    bool l2 = s2 && c[6];
+
+    out[CHOICE] = (uint8_t)sum;
+    out[FOURKIND] = four ? (uint8_t)sum : 0;
+    out[FULLHOUSE] = (three && two) ? 25 : 0;
+    out[SSTRAIGHT] = (s1 || s2 || s3) ? 30 : 0;
+    out[LSTRAIGHT] = (l1 || l2) ? 40 : 0;
+    out[YACHT] = yacht ? 50 : 0;
+}
+
+constexpr HandTable BuildHandTable()
+{
+    HandTable t{};
+
+    // 정렬된 조합 252개
+    for (int a = 0; a < FACE_COUNT; a++)
+        for (int b = a; b < FACE_COUNT; b++)
+            for (int c = b; c < FACE_COUNT; c++)
+                for (int d = c; d < FACE_COUNT; d++)
+                    for (int e = d; e < FACE_COUNT; e++)
+                    {
+                        int s[DICE_COUNT] = { a, b, c, d, e };
+                        int h = RankSorted(s);
+                        for (int i = 0; i < DICE_COUNT; i++)
+                        {
+                            t.faces[h][i] = (uint8_t)(s[i] + 1);
+                            t.counts[h][s[i] + 1]++;
+                        }
+                        ScoreHand(t.counts[h], t.score[h]);
+                    }
+
+    // 순서 있는 주사위 7776개 -> 조합 번호
+    for (int code = 0; code < RAW_HAND_COUNT; code++)
+    {
+        int cnt[FACE_COUNT] = {};
+        int x = code;
+        for (int i = 0; i < DICE_COUNT; i++) { cnt[x % FACE_COUNT]++; x /= FACE_COUNT; }
+
+        int s[DICE_COUNT] = {};
+        int n = 0;
+        for (int v = 0; v < FACE_COUNT; v++)
+            for (int k = 0; k < cnt[v]; k++) s[n++] = v;
+
+        t.index[code] = (uint8_t)RankSorted(s);
+    }
+    return t;
+}
+
+inline constexpr HandTable gHandTable = BuildHandTable();
+
+static_assert(gHandTable.faces[0][0] == 1 && gHandTable.faces[HAND_COUNT - 1][0] == 6,
+    "hand table must cover all 252 multisets");
+
+// =============================================================
+// 조회 함수
+// =============================================================
+
+// 주사위 5개(1~6, 순서 무관) -> 조합 번호 0~251
+template <class T>
+inline int HandIndex(const T dice[DICE_COUNT])
+{
+    int code = (dice[0] - 1) * 1296 + (dice[1] - 1) * 216 + (dice[2] - 1) * 36
+        + (dice[3] - 1) * 6 + (dice[4] - 1);
+    return gHandTable.index[code];
+}
+
+inline int HandScore(int hand, int cat)
+{
+    return gHandTable.score[hand][cat];
+}
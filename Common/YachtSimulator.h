@@ -0,0 +1,232 @@
+﻿#pragma once
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "YachtRng.h"
+#include "YachtRules.h"
+#include "YachtKeep.h"
+#include "YachtSolver.h"
+
+// =============================================================
+// 헤드리스 몬테카를로 시뮬레이터
+//  - 정책(Policy)을 갈아 끼우며 12턴 게임을 끝까지 반복
+//  - 게임을 묶음(chunk) 단위로 스레드에 나누고, 묶음마다 Philox 스트림
+//    (seed, 묶음 번호)을 따로 써서 스레드 수와 관계없이 같은 결과가 나온다
+//  - 최종 점수 분포는 스레드별로 모은 뒤 atomic 덧셈으로 합친다 (락 없음)
+// =============================================================
+constexpr int MAX_GAME_SCORE = 5 + 10 + 15 + 20 + 25 + 30 + 30 + 30 + 25 + 30 + 40 + 50;
+
+// 정책은 상태가 없어야 한다 (여러 스레드가 같은 객체를 공유)
+struct Policy
+{
+    virtual ~Policy() {}
+    virtual const char* Name() const = 0;
+
+    // 실제 주사위 위치 기준 고정 비트 (31 = 모두 고정 = 굴리기 종료)
+    virtual int ChooseHold(const ScoreCard& card, const DiceHand& dice, int rollsLeft) const = 0;
+    virtual CategoryType ChooseCategory(const ScoreCard& card, const DiceHand& dice) const = 0;
+};
+
+// 지금 당장 점수가 가장 높은 빈 카테고리
+inline CategoryType BestImmediateCategory(const ScoreCard& card, const DiceHand& dice)
+{
+    int h = dice.Index();
+    int best = -1, bestCat = 0;
+    for (int c = 0; c < CATCOUNT; c++)
+    {
+        if (card.IsUsed(c)) continue;
+        if (gHandTable.score[h][c] > best) { best = gHandTable.score[h][c]; bestCat = c; }
+    }
+    return (CategoryType)bestCat;
+}
+
+// 가장 많이 나온 눈만 고정, 즉시 점수 최대 카테고리
+struct GreedyPolicy : Policy
+{
+    const char* Name() const override { return "greedy"; }
+
+    int ChooseHold(const ScoreCard&, const DiceHand& dice, int) const override
+    {
+        const uint8_t* c = gHandTable.counts[dice.Index()];
+        int face = 1;
+        for (int v = 2; v <= FACE_COUNT; v++)
+            if (c[v] >= c[face]) face = v;
+
+        int hold = 0;
+        for (int i = 0; i < DICE_COUNT; i++)
+            if (dice.value[i] == face) hold |= 1 << i;
+        return hold;
+    }
+
+    CategoryType ChooseCategory(const ScoreCard& card, const DiceHand& dice) const override
+    {
+        return BestImmediateCategory(card, dice);
+    }
+};
+
+// 한 번 더 굴렸을 때 빈 카테고리 기대 점수가 최대인 고정
+struct LookaheadPolicy : Policy
+{
+    const char* Name() const override { return "lookahead"; }
+
+    int ChooseHold(const ScoreCard& card, const DiceHand& dice, int) const override
+    {
+        float e[HOLD_MASKS][CATCOUNT];
+        ExpectedCategoryScores(dice.value, e);
+
+        float best = -1.0f;
+        int bestHold = HOLD_MASKS - 1;
+        for (int m = 0; m < HOLD_MASKS; m++)
+            for (int c = 0; c < CATCOUNT; c++)
+                if (!card.IsUsed(c) && e[m][c] > best) { best = e[m][c]; bestHold = m; }
+        return bestHold;
+    }
+
+    CategoryType ChooseCategory(const ScoreCard& card, const DiceHand& dice) const override
+    {
+        return BestImmediateCategory(card, dice);
+    }
+};
+
+// 전략 테이블 (기댓값 최적)
+struct OptimalPolicy : Policy
+{
+    StrategyView strategy;
+
+    explicit OptimalPolicy(const StrategyView& view) : strategy(view) {}
+    const char* Name() const override { return "optimal"; }
+
+    int ChooseHold(const ScoreCard& card, const DiceHand& dice, int rollsLeft) const override
+    {
+        return strategy.BestHold(card.usedMask, rollsLeft, dice);
+    }
+
+    CategoryType ChooseCategory(const ScoreCard& card, const DiceHand& dice) const override
+    {
+        return (CategoryType)strategy.BestCategory(card.usedMask, dice);
+    }
+};
+
+// =============================================================
+// 게임 한 판
+// =============================================================
+// d6() 는 1~6 을 돌려준다 (D6Sampler)
+template <class Dice>
+void PlayGame(const Policy& policy, Dice& d6, ScoreCard& card)
+{
+    card = ScoreCard();
+
+    for (int turn = 0; turn < TURN_COUNT; turn++)
+    {
+        DiceHand dice;
+        for (int i = 0; i < DICE_COUNT; i++) dice.value[i] = (uint8_t)d6();
+
+        for (int rollsLeft = MAX_ROLLS - 1; rollsLeft > 0; rollsLeft--)
+        {
+            int hold = policy.ChooseHold(card, dice, rollsLeft);
+            if (hold == HOLD_MASKS - 1) break;
+            for (int i = 0; i < DICE_COUNT; i++)
+                if (!(hold & (1 << i))) dice.value[i] = (uint8_t)d6();
+        }
+
+        CategoryType cat = policy.ChooseCategory(card, dice);
+        if (card.IsUsed(cat)) cat = BestImmediateCategory(card, dice);
+        card.Record(cat, dice);
+    }
+}
+
+// =============================================================
+// 병렬 시뮬레이션
+// =============================================================
+struct SimulationResult
+{
+    std::atomic<uint64_t> histogram[MAX_GAME_SCORE + 1];  // [총점] 판 수
+    std::atomic<uint64_t> categorySum[CATCOUNT];
+    uint64_t games = 0;
+    double   seconds = 0;
+
+    SimulationResult()
+    {
+        for (auto& h : histogram) h = 0;
+        for (auto& c : categorySum) c = 0;
+    }
+
+    double Mean() const
+    {
+        double s = 0;
+        for (int i = 0; i <= MAX_GAME_SCORE; i++) s += (double)i * histogram[i];
+        return games ? s / games : 0.0;
+    }
+
+    double StdDev() const
+    {
+        double m = Mean(), s = 0;
+        for (int i = 0; i <= MAX_GAME_SCORE; i++) s += (i - m) * (i - m) * histogram[i];
+        return games ? std::sqrt(s / games) : 0.0;
+    }
+
+    // p = 0~1
+    int Percentile(double p) const
+    {
+        if (!games) return 0;
+        uint64_t target = (uint64_t)(p * (games - 1)), acc = 0;
+        for (int i = 0; i <= MAX_GAME_SCORE; i++)
+        {
+            acc += histogram[i];
+            if (acc > target) return i;
+        }
+        return MAX_GAME_SCORE;
+    }
+};
+
+constexpr uint64_t SIM_CHUNK = 4096;
+
+// threads <= 0 이면 하드웨어 스레드 수
+inline void Simulate(const Policy& policy, uint64_t games, uint64_t seed, int threads,
+    SimulationResult& result)
+{
+    if (threads <= 0) threads = (int)std::thread::hardware_concurrency();
+    if (threads <= 0) threads = 1;
+    GetKeepTransitions();
+
+    uint64_t chunks = (games + SIM_CHUNK - 1) / SIM_CHUNK;
+    std::atomic<uint64_t> nextChunk{ 0 };
+
+    auto worker = [&]() {
+        std::vector<uint64_t> hist(MAX_GAME_SCORE + 1, 0);
+        uint64_t catSum[CATCOUNT] = {};
+        ScoreCard card;
+
+        for (uint64_t ch = nextChunk++; ch < chunks; ch = nextChunk++)
+        {
+            D6Sampler<Philox4x32> d6(Philox4x32(seed, ch));
+
+            uint64_t end = (ch + 1) * SIM_CHUNK < games ? (ch + 1) * SIM_CHUNK : games;
+            for (uint64_t g = ch * SIM_CHUNK; g < end; g++)
+            {
+                PlayGame(policy, d6, card);
+                hist[card.Total()]++;
+                for (int c = 0; c < CATCOUNT; c++) catSum[c] += card.score[c];
+            }
+        }
+
+        for (int i = 0; i <= MAX_GAME_SCORE; i++)
+            if (hist[i]) result.histogram[i].fetch_add(hist[i], std::memory_order_relaxed);
+        for (int c = 0; c < CATCOUNT; c++)
+            result.categorySum[c].fetch_add(catSum[c], std::memory_order_relaxed);
+    };
+
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; t++) pool.emplace_back(worker);
+    worker();
+    for (std::thread& th : pool) th.join();
+    auto t1 = std::chrono::steady_clock::now();
+
+    result.games += games;
+    result.seconds += std::chrono::duration<double>(t1 - t0).count();
+}
@@ -0,0 +1,338 @@
+﻿#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include "YachtRules.h"
+#include "YachtKeep.h"
+#include "YachtMappedFile.h"
+
+// =============================================================
+// 1인 요트 최적 전략 (기댓값 최대화)
+//  - 턴 사이 상태 = 사용한 카테고리 12비트 마스크 (4096가지)
+//  - 턴 안 상태   = (남은 굴리기 횟수, 손패 252가지)
+//  - 모든 칸이 찬 마스크부터 거꾸로(retrograde) 기댓값을 채운다
+//
+// 정책 테이블 policy[mask][rollsLeft][hand]
+//  - rollsLeft == 0 : 기록할 카테고리 (CategoryType)
+//  - rollsLeft >= 1 : 정렬된 눈 기준 고정 비트 (0~31)
+//
+// 단계 수 (= 턴 첫 주사위 뒤에 다시 굴릴 수 있는 횟수 + 1) 는 규칙마다 다르다
+//  - 콘솔 (yacht_rule)      : 굴리기 MAX_ROLLS 번 = 다시 굴리기 MAX_ROLLS - 1 번 -> STAGE_COUNT
+//  - GL 게임 (GameState)   : 나눠 준 뒤 다시 굴리기 MAX_ROLLS 번                -> GAME_STAGE_COUNT
+//  => 테이블도 따로 푼다 (yacht_solver / yacht_solver --game)
+// =============================================================
+constexpr int MASK_COUNT = 1 << CATCOUNT;
+constexpr int FULL_MASK = MASK_COUNT - 1;
+constexpr int STAGE_COUNT = MAX_ROLLS;            // 남은 굴리기 0 ~ MAX_ROLLS-1
+constexpr int GAME_STAGE_COUNT = MAX_ROLLS + 1;   // 남은 굴리기 0 ~ MAX_ROLLS
+
+// 정책 배열 위치 (mask, rollsLeft, hand) -> 일렬 번호
+inline size_t StrategyIndex(int mask, int rollsLeft, int hand, int stages = STAGE_COUNT)
+{
+    return ((size_t)mask * stages + rollsLeft) * HAND_COUNT + hand;
+}
+
+// 배열을 소유하지 않는 조회용 뷰 (메모리 / 매핑 파일 공용)
+struct StrategyView
+{
+    const float*   turnValue = nullptr;   // [mask] 턴 시작 시점의 남은 기대 점수
+    const uint8_t* policy = nullptr;      // [mask][stage][hand]
+    int            stageCount = STAGE_COUNT;
+
+    bool IsValid() const { return policy != nullptr; }
+    float ExpectedScore() const { return turnValue ? turnValue[0] : 0.0f; }
+
+    int BestCategory(int mask, const DiceHand& dice) const
+    {
+        return policy[StrategyIndex(mask, 0, dice.Index(), stageCount)];
+    }
+
+    // 실제 주사위 위치 기준 고정 비트
+    int BestHold(int mask, int rollsLeft, const DiceHand& dice) const
+    {
+        int h = dice.Index();
+        int sorted = policy[StrategyIndex(mask, rollsLeft, h, stageCount)];
+
+        int hold = 0;
+        for (int i = 0; i < DICE_COUNT; i++)
+        {
+            if (!(sorted & (1 << i))) continue;
+            int face = gHandTable.faces[h][i];
+            for (int j = 0; j < DICE_COUNT; j++)
+            {
+                if ((hold & (1 << j)) || dice.value[j] != face) continue;
+                hold |= 1 << j;
+                break;
+            }
+        }
+        return hold;
+    }
+};
+
+// 풀이 결과 (배열 소유)
+struct StrategyTable
+{
+    std::vector<float>   turnValue;
+    std::vector<uint8_t> policy;
+    int                  stageCount = STAGE_COUNT;
+
+    StrategyView View() const
+    {
+        StrategyView v;
+        v.turnValue = turnValue.data();
+        v.policy = policy.data();
+        v.stageCount = stageCount;
+        return v;
+    }
+
+    float ExpectedScore() const { return turnValue.empty() ? 0.0f : turnValue[0]; }
+};
+
+// =============================================================
+// 한 턴 풀이: turnValue 에서 mask 보다 카테고리가 많이 찬 상태는 이미 계산되어 있어야 한다
+// =============================================================
+inline float SolveTurn(int mask, const float* turnValue, uint8_t* policy /* [stage][hand] */, int stages)
+{
+    const KeepTable& kt = GetKeepTable();
+
+    float v[HAND_COUNT];
+    float k[KEEP_COUNT];
+
+    // 남은 굴리기 0: 카테고리 선택
+    for (int h = 0; h < HAND_COUNT; h++)
+    {
+        float best = -1.0f;
+        int bestCat = 0;
+        for (int c = 0; c < CATCOUNT; c++)
+        {
+            if (mask & (1 << c)) continue;
+            float e = gHandTable.score[h][c] + turnValue[mask | (1 << c)];
+            if (e > best) { best = e; bestCat = c; }
+        }
+        v[h] = best;
+        policy[h] = (uint8_t)bestCat;
+    }
+
+    // 남은 굴리기 1, 2, ...: 고정 조합별 기댓값 -> 손패별 최선의 고정
+    for (int stage = 1; stage < stages; stage++)
+    {
+        for (int i = KEEP_COUNT - 1; i >= 0; i--)
+        {
+            if (kt.handOf[i] >= 0) { k[i] = v[kt.handOf[i]]; continue; }
+            float s = 0.0f;
+            for (int f = 1; f <= FACE_COUNT; f++) s += k[kt.child[i][f]];
+            k[i] = s * (1.0f / FACE_COUNT);
+        }
+
+        uint8_t* pol = policy + stage * HAND_COUNT;
+        for (int h = 0; h < HAND_COUNT; h++)
+        {
+            float best = -1.0f;
+            int bestHold = 0;
+            for (int j = 0; j < kt.holdCount[h]; j++)
+            {
+                float e = k[kt.holdKeep[h][j]];
+                if (e > best) { best = e; bestHold = kt.holdMask[h][j]; }
+            }
+            v[h] = best;
+            pol[h] = (uint8_t)bestHold;
+        }
+    }
+
+    // 턴 첫 굴리기
+    float e = 0.0f;
+    for (int h = 0; h < HAND_COUNT; h++) e += kt.handProb[h] * v[h];
+    return e;
+}
+
+// =============================================================
+// 병렬 풀이
+//  - 같은 개수의 칸이 찬 마스크(한 층)끼리는 서로 의존하지 않으므로
+//    층 단위로 스레드에 나눠 풀고, 층이 끝날 때마다 합류한다
+//  - 스레드마다 연속 구간을 하나씩 맡되, 자기 구간이 끝나면
+//    다른 스레드 구간의 남은 마스크를 가져와(work stealing) 푼다
+// =============================================================
+struct alignas(64) SolveSlice
+{
+    std::atomic<int> next{ 0 };
+    int end = 0;
+};
+
+inline void SolveLayer(StrategyTable& table, const std::vector<int>& masks, int threads)
+{
+    int n = (int)masks.size();
+    if (threads > n) threads = n;
+    if (threads <= 1)
+    {
+        for (int mask : masks)
+            table.turnValue[mask] = SolveTurn(mask, table.turnValue.data(),
+                &table.policy[StrategyIndex(mask, 0, 0, table.stageCount)], table.stageCount);
+        return;
+    }
+
+    std::vector<SolveSlice> slices(threads);
+    for (int t = 0; t < threads; t++)
+    {
+        slices[t].next = n * t / threads;
+        slices[t].end = n * (t + 1) / threads;
+    }
+
+    auto worker = [&](int self) {
+        for (int i = 0; i < threads; i++)
+        {
+            SolveSlice& s = slices[(self + i) % threads];
+            for (int j = s.next++; j < s.end; j = s.next++)
+            {
+                int mask = masks[j];
+                table.turnValue[mask] = SolveTurn(mask, table.turnValue.data(),
+                    &table.policy[StrategyIndex(mask, 0, 0, table.stageCount)], table.stageCount);
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; t++) pool.emplace_back(worker, t);
+    worker(0);
+    for (std::thread& th : pool) th.join();
+}
+
+// threads <= 0 이면 하드웨어 스레드 수. stages = STAGE_COUNT (콘솔) 또는 GAME_STAGE_COUNT (GL 게임)
+inline void SolveStrategy(StrategyTable& table, int threads = 0, int stages = STAGE_COUNT)
+{
+    if (threads <= 0) threads = (int)std::thread::hardware_concurrency();
+    if (threads <= 0) threads = 1;
+
+    GetKeepTable();
+    table.stageCount = stages;
+    table.turnValue.assign(MASK_COUNT, 0.0f);
+    table.policy.assign((size_t)MASK_COUNT * stages * HAND_COUNT, 0);
+
+    std::vector<int> layers[CATCOUNT + 1];
+    for (int mask = 0; mask < MASK_COUNT; mask++)
+    {
+        int pc = 0;
+        for (int c = 0; c < CATCOUNT; c++) pc += (mask >> c) & 1;
+        layers[pc].push_back(mask);
+    }
+
+    // 찬 칸이 많은 층부터 (모두 찬 층은 기댓값 0)
+    for (int filled = CATCOUNT - 1; filled >= 0; filled--)
+        SolveLayer(table, layers[filled], threads);
+}
+
+// =============================================================
+// 저장 / 불러오기 (메모리 매핑)
+//  - 고정 크기 헤더 + 64바이트 정렬된 배열 두 개
+//    [헤더][turnValue float x 4096][policy uint8 x 4096*단계 수*252]
+//  - 헤더와 각 배열에 FNV-1a 체크섬
+//  - 파일을 읽기 전용으로 매핑해 배열을 그대로 조회하므로
+//    여러 봇 프로세스가 같은 페이지 캐시를 공유한다
+// =============================================================
+constexpr uint32_t STRATEGY_FILE_VERSION = 2;
+constexpr size_t STRATEGY_ALIGN = 64;
+
+struct StrategyFileHeader
+{
+    char     magic[4];          // "YSTR"
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t maskCount;
+    uint32_t stageCount;
+    uint32_t handCount;
+    float    expectedScore;
+    uint32_t reserved;
+    uint64_t valueOffset, valueSize;
+    uint64_t policyOffset, policySize;
+    uint64_t valueChecksum;
+    uint64_t policyChecksum;
+    uint64_t headerChecksum;    // 이 필드를 0 으로 두고 계산
+};
+
+inline uint64_t StrategyHeaderChecksum(StrategyFileHeader hdr)
+{
+    hdr.headerChecksum = 0;
+    return Fnv1a64(&hdr, sizeof(hdr));
+}
+
+inline bool SaveStrategy(const StrategyTable& table, const char* path)
+{
+    StrategyFileHeader hdr = {};
+    hdr.magic[0] = 'Y'; hdr.magic[1] = 'S'; hdr.magic[2] = 'T'; hdr.magic[3] = 'R';
+    hdr.version = STRATEGY_FILE_VERSION;
+    hdr.headerSize = sizeof(hdr);
+    hdr.maskCount = MASK_COUNT;
+    hdr.stageCount = (uint32_t)table.stageCount;
+    hdr.handCount = HAND_COUNT;
+    hdr.expectedScore = table.ExpectedScore();
+    hdr.valueOffset = AlignUp(sizeof(hdr), STRATEGY_ALIGN);
+    hdr.valueSize = table.turnValue.size() * sizeof(float);
+    hdr.policyOffset = AlignUp(hdr.valueOffset + hdr.valueSize, STRATEGY_ALIGN);
+    hdr.policySize = table.policy.size();
+    hdr.valueChecksum = Fnv1a64(table.turnValue.data(), hdr.valueSize);
+    hdr.policyChecksum = Fnv1a64(table.policy.data(), hdr.policySize);
+    hdr.headerChecksum = StrategyHeaderChecksum(hdr);
+
+    std::ofstream f(path, std::ios::binary);
+    if (!f.is_open()) return false;
+
+    static const char pad[STRATEGY_ALIGN] = {};
+    f.write((const char*)&hdr, sizeof(hdr));
+    f.write(pad, hdr.valueOffset - sizeof(hdr));
+    f.write((const char*)table.turnValue.data(), hdr.valueSize);
+    f.write(pad, hdr.policyOffset - (hdr.valueOffset + hdr.valueSize));
+    f.write((const char*)table.policy.data(), hdr.policySize);
+    return (bool)f;
+}
+
+// 매핑된 전략 파일 (조회는 view 로)
+struct MappedStrategy
+{
+    MappedFile   file;
+    StrategyView view;
+
+    // stages: 기대하는 규칙의 단계 수 (다른 규칙으로 푼 파일은 거부)
+    // verify: 배열 체크섬까지 확인 (헤더는 항상 확인)
+    bool Open(const char* path, int stages = STAGE_COUNT, bool verify = true)
+    {
+        view = StrategyView();
+        if (!file.Open(path)) return false;
+
+        StrategyFileHeader hdr;
+        if (file.size < sizeof(hdr)) return Fail();
+        memcpy(&hdr, file.data, sizeof(hdr));
+
+        if (hdr.magic[0] != 'Y' || hdr.magic[1] != 'S' || hdr.magic[2] != 'T' || hdr.magic[3] != 'R'
+            || hdr.version != STRATEGY_FILE_VERSION || hdr.headerSize != sizeof(hdr)
+            || hdr.headerChecksum != StrategyHeaderChecksum(hdr))
+            return Fail();
+
+        if (hdr.maskCount != MASK_COUNT || hdr.stageCount != (uint32_t)stages || hdr.handCount != HAND_COUNT
+            || hdr.valueSize != MASK_COUNT * sizeof(float)
+            || hdr.policySize != (uint64_t)MASK_COUNT * stages * HAND_COUNT
+            || hdr.valueOffset % STRATEGY_ALIGN || hdr.policyOffset % STRATEGY_ALIGN
+            || hdr.valueOffset + hdr.valueSize > file.size
+            || hdr.policyOffset + hdr.policySize > file.size)
+            return Fail();
+
+        const uint8_t* values = file.data + hdr.valueOffset;
+        const uint8_t* policy = file.data + hdr.policyOffset;
+        if (verify && (Fnv1a64(values, hdr.valueSize) != hdr.valueChecksum
+            || Fnv1a64(policy, hdr.policySize) != hdr.policyChecksum))
+            return Fail();
+
+        view.turnValue = (const float*)values;
+        view.policy = policy;
+        view.stageCount = stages;
+        return true;
+    }
+
+    bool Fail()
+    {
+        file.Close();
+        return false;
+    }
+};
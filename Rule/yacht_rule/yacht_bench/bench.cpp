@@ -0,0 +1,140 @@
+﻿#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdio>
+
+#include "../../../Common/YachtRng.h"
+#include "../../../Common/YachtRules.h"
+#include "../../../Common/YachtBatch.h"
+#include "../../../Common/YachtKeep.h"
+
+using namespace std;
+
+// 점수 계산 마이크로벤치마크: 초당 채점한 손패 수 (12개 카테고리 전부)
+
+const int HANDS = 1 << 20;
+const int REPEAT = 20;
+
+// 테이블 이전 방식 (히스토그램을 매번 새로 센다) - 비교용
+int scoreHistogram(const DiceHand& hand, int cat) {
+    int c[7] = { 0 };
+    for (int v : hand.value) c[v]++;
+    int sum = hand.Sum();
+    switch (cat) {
+    case CHOICE: return sum;
+    case FOURKIND:
+        for (int v = 1; v <= 6; v++) if (c[v] >= 4) return sum;
+        return 0;
+    case FULLHOUSE: {
+        bool t = false, d = false;
+        for (int v = 1; v <= 6; v++) { if (c[v] == 3) t = true; if (c[v] == 2) d = true; }
+        return (t && d) ? 25 : 0;
+    }
+    case SSTRAIGHT:
+        return ((c[1] && c[2] && c[3] && c[4]) || (c[2] && c[3] && c[4] && c[5])
+            || (c[3] && c[4] && c[5] && c[6])) ? 30 : 0;
+    case LSTRAIGHT:
+        return ((c[1] && c[2] && c[3] && c[4] && c[5]) || (c[2] && c[3] && c[4] && c[5] && c[6])) ? 40 : 0;
+    case YACHT:
+        for (int v = 1; v <= 6; v++) if (c[v] == 5) return 50;
+        return 0;
+    default:
+        return c[cat + 1] * (cat + 1);
+    }
+}
+
+template <class F>
+void run(const char* name, const vector<DiceHand>& hands, F score) {
+    long long checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++)
+        for (const DiceHand& h : hands)
+            for (int c = 0; c < CATCOUNT; c++)
+                checksum += score(h, c);
+    auto t1 = chrono::steady_clock::now();
+
+    double sec = chrono::duration<double>(t1 - t0).count();
+    double hands_per_sec = (double)hands.size() * REPEAT / sec;
+    printf("%-12s %8.3f s  %12.0f hands/s  (checksum %lld)\n", name, sec, hands_per_sec, checksum);
+}
+
+// SoA 일괄 채점 (커널별)
+void runBatch(BatchKernel kernel, const vector<DiceHand>& hands) {
+    vector<uint8_t> lane[DICE_COUNT];
+    const uint8_t* lanes[DICE_COUNT];
+    for (int i = 0; i < DICE_COUNT; i++) {
+        lane[i].resize(hands.size());
+        for (size_t k = 0; k < hands.size(); k++) lane[i][k] = hands[k].value[i];
+        lanes[i] = lane[i].data();
+    }
+    vector<uint8_t> out(hands.size() * CATCOUNT);
+
+    long long checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++)
+        ScoreBatch(lanes, hands.size(), out.data(), kernel);
+    auto t1 = chrono::steady_clock::now();
+    for (uint8_t v : out) checksum += v;
+
+    double sec = chrono::duration<double>(t1 - t0).count();
+    double hands_per_sec = (double)hands.size() * REPEAT / sec;
+    printf("batch-%-6s %8.3f s  %12.0f hands/s  (checksum %lld)\n",
+        BatchKernelName(kernel), sec, hands_per_sec, checksum);
+}
+
+// 32가지 고정 비트 x 12개 카테고리 기대 점수 (결정 1회)
+void runHoldEval(const vector<DiceHand>& hands) {
+    const int DECISIONS = 200000;
+    GetKeepTransitions();
+
+    float out[HOLD_MASKS][CATCOUNT];
+    double checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (int i = 0; i < DECISIONS; i++) {
+        ExpectedCategoryScores(hands[i].value, out);
+        checksum += out[i & (HOLD_MASKS - 1)][i % CATCOUNT];
+    }
+    auto t1 = chrono::steady_clock::now();
+
+    double sec = chrono::duration<double>(t1 - t0).count();
+    printf("hold-eval    %8.3f s  %12.2f us/decision  (checksum %.1f)\n",
+        sec, sec * 1e6 / DECISIONS, checksum);
+}
+
+// 주사위 눈 생성 속도 (초당 눈 수)
+template <class F>
+void runDice(const char* name, F roll) {
+    const int DRAWS = 1 << 26;
+    long long checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (int i = 0; i < DRAWS; i++) checksum += roll();
+    auto t1 = chrono::steady_clock::now();
+
+    double sec = chrono::duration<double>(t1 - t0).count();
+    printf("d6-%-9s %8.3f s  %12.0f dice/s   (checksum %lld)\n", name, sec, DRAWS / sec, checksum);
+}
+
+int main() {
+    mt19937 gen(12345);
+    uniform_int_distribution<int> dist(1, 6);
+
+    vector<DiceHand> hands(HANDS);
+    for (DiceHand& h : hands)
+        for (uint8_t& v : h.value) v = (uint8_t)dist(gen);
+
+    run("histogram", hands, scoreHistogram);
+    run("table", hands, [](const DiceHand& h, int c) { return Score(h, (CategoryType)c); });
+
+    runBatch(BATCH_SCALAR, hands);
+    if (gBatchKernel >= BATCH_SSE2) runBatch(BATCH_SSE2, hands);
+    if (gBatchKernel >= BATCH_AVX2) runBatch(BATCH_AVX2, hands);
+
+    runHoldEval(hands);
+
+    runDice("mt19937", [&]() { return dist(gen); });
+    D6Sampler<Xoshiro256pp> xo(Xoshiro256pp(12345));
+    runDice("xoshiro", [&]() { return xo(); });
+    D6Sampler<Philox4x32> ph(Philox4x32(12345));
+    runDice("philox", [&]() { return ph(); });
+}
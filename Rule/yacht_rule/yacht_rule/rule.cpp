@@ -1,155 +1,218 @@
 #include <iostream>
-#include <vector>
 #include <algorithm>
 #include <random>
-#include <map>
 #include <string>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <cerrno>
+#include <limits>
+
+#include "../../../Common/YachtRng.h"
+#include "../../../Common/YachtRules.h"
+#include "../../../Common/YachtSolver.h"
+#include "../../../Common/YachtSimulator.h"
 
 using namespace std;
 
 random_device rd;
-mt19937 gen(rd());
-uniform_int_distribution<int> dist(1, 6);
+D6Sampler<Xoshiro256pp> dist(Xoshiro256pp(((uint64_t)rd() << 32) | rd()));
 
-struct ScoreCard {
-    map<string, int> scores;
-    bool used[12] = { false };
-};
-
-void printDice(const vector<int>& dice) {
+void printDice(const DiceHand& dice) {
     cout << "ֻ: ";
-    for (int i : dice) cout << i << " ";
+    for (int v : dice.value) cout << v << " ";
     cout << endl;
 }
 
-vector<int> rollDice(const vector<bool>& hold) {
-    vector<int> dice(5);
-    for (int i = 0; i < 5; i++) {
-        if (!hold[i]) dice[i] = dist(gen);
-    }
-    return dice;
-}
-
-int sumDice(const vector<int>& dice) {
-    int s = 0;
-    for (int d : dice) s += d;
-    return s;
-}
-
-int countNum(const vector<int>& dice, int num) {
-    return count(dice.begin(), dice.end(), num);
-}
-
-//   
-int calcScore(const string& category, const vector<int>& dice) {
-    vector<int> d = dice;
-    sort(d.begin(), d.end());
-    int sum = sumDice(d);
-    if (category == "Aces") return countNum(d, 1) * 1;
-    if (category == "Deuces") return countNum(d, 2) * 2;
-    if (category == "Threes") return countNum(d, 3) * 3;
-    if (category == "Fours") return countNum(d, 4) * 4;
-    if (category == "Fives") return countNum(d, 5) * 5;
-    if (category == "Sixes") return countNum(d, 6) * 6;
-    if (category == "Choice") return sum;
-
-    // Four of a Kind
-    for (int i = 1; i <= 6; i++) if (countNum(d, i) >= 4) return sum;
-
-    // Full House (3 + 2)
-    bool three = false, two = false;
-    for (int i = 1; i <= 6; i++) {
-        int c = countNum(d, i);
-        if (c == 3) three = true;
-        if (c == 2) two = true;
-    }
-    if (category == "Full House" && three && two) return 25;
-
-    // Small Straight ( 4)
-    if (category == "S. Straight") {
-        vector<vector<int>> smalls = { {1,2,3,4}, {2,3,4,5}, {3,4,5,6} };
-        for (auto& s : smalls)
-            if (includes(d.begin(), d.end(), s.begin(), s.end())) return 30;
+void rollDice(DiceHand& dice, const bool hold[DICE_COUNT]) {
+    for (int i = 0; i < DICE_COUNT; i++) {
+        if (!hold[i]) dice.value[i] = (uint8_t)dist();
     }
-
-    // Large Straight ( 5)
-    if (category == "L. Straight") {
-        vector<vector<int>> larges = { {1,2,3,4,5}, {2,3,4,5,6} };
-        for (auto& s : larges)
-            if (includes(d.begin(), d.end(), s.begin(), s.end())) return 40;
-    }
-
-    // Yacht (5   )
-    if (category == "Yacht") {
-        if (countNum(d, d[0]) == 5) return 50;
-    }
-
-    return 0;
 }
 
 void printCategories(const ScoreCard& card) {
-    vector<string> categories = {
-        "Aces", "Deuces", "Threes", "Fours", "Fives", "Sixes",
-        "Choice", "4 of a Kind", "Full House", "S. Straight", "L. Straight", "Yacht"
-    };
     cout << "\n===  ===\n";
-    for (int i = 0; i < categories.size(); i++) {
-        cout << i + 1 << ". " << categories[i] << " : ";
-        if (card.used[i]) cout << card.scores.at(categories[i]) << "";
+    for (int i = 0; i < CATCOUNT; i++) {
+        cout << i + 1 << ". " << CATEGORY_NAMES[i] << " : ";
+        if (card.IsUsed(i)) cout << card.score[i] << "";
         cout << endl;
     }
 }
 
-int main() {
-    vector<string> categories = {
-        "Aces", "Deuces", "Threes", "Fours", "Fives", "Sixes",
-        "Choice", "4 of a Kind", "Full House", "S. Straight", "L. Straight", "Yacht"
-    };
+//  ̺ Ʈ (yacht_strategy.bin   )
+void printHoldHint(const StrategyView& strategy, const ScoreCard& card, const DiceHand& dice, int rollsLeft) {
+    if (!strategy.IsValid()) return;
+    int hold = strategy.BestHold(card.usedMask, rollsLeft, dice);
+    cout << "õ : ";
+    if (hold == HOLD_MASKS - 1) cout << " (0)";
+    else if (hold == 0) cout << " (-)";
+    for (int i = 0; i < DICE_COUNT && hold != HOLD_MASKS - 1; i++)
+        if (hold & (1 << i)) cout << i + 1 << " ";
+    cout << endl;
+}
+
+void printCategoryHint(const StrategyView& strategy, const ScoreCard& card, const DiceHand& dice) {
+    if (!strategy.IsValid()) return;
+    int cat = strategy.BestCategory(card.usedMask, dice);
+    cout << "õ : " << cat + 1 << ". " << CATEGORY_NAMES[cat] << endl;
+}
 
+void playInteractive() {
     ScoreCard card;
-    for (auto& c : categories) card.scores[c] = 0;
+    MappedStrategy strategy;
+    strategy.Open("yacht_strategy.bin");
 
-    for (int turn = 1; turn <= 12; turn++) {
+    for (int turn = 1; turn <= TURN_COUNT; turn++) {
         cout << "\n====  " << turn << " ====\n";
 
-        vector<int> dice(5);
-        vector<bool> hold(5, false);
+        DiceHand dice;
+        bool hold[DICE_COUNT] = { false };
 
         // ù 
-        for (int i = 0; i < 5; i++) dice[i] = dist(gen);
+        rollDice(dice, hold);
         printDice(dice);
 
-        for (int r = 0; r < 2; r++) {
-            cout << " ֻ ȣ Է (1~5, , 0=׸): ";
+        for (int r = 1; r < MAX_ROLLS; r++) {
+            printHoldHint(strategy.view, card, dice, MAX_ROLLS - r);
+            cout << " ֻ ȣ Է (1~5, , 0=׸, -= ٽ): ";
             string line;
             getline(cin, line);
             if (line == "0" || line.empty()) break;
-            fill(hold.begin(), hold.end(), false);
-            for (char c : line) if (isdigit(c)) hold[c - '1'] = true;
-            for (int i = 0; i < 5; i++) if (!hold[i]) dice[i] = dist(gen);
+            // "-"  ƹ͵  ʰ ٽ 
+            fill(hold, hold + DICE_COUNT, false);
+            for (char c : line) if (c >= '1' && c <= '0' + DICE_COUNT) hold[c - '1'] = true;
+            rollDice(dice, hold);
             printDice(dice);
         }
 
         printCategories(card);
-        int choice;
+        printCategoryHint(strategy.view, card, dice);
+        int choice = 0;
         cout << "  ȣ : ";
-        cin >> choice;
-        cin.ignore();
+        while (true) {
+            if (!(cin >> choice)) {
+                if (cin.eof()) return;
+                cin.clear();
+                choice = 0;
+            }
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+
+            if (choice < 1 || choice > CATCOUNT) cout << "1~" << CATCOUNT << "  ȣ Էϼ: ";
+            else if (card.IsUsed(choice - 1)) cout << "̹  ׸Դϴ. ٽ : ";
+            else break;
+        }
+
+        CategoryType category = (CategoryType)(choice - 1);
+        card.Record(category, dice);
+        cout << CATEGORY_NAMES[category] << " " << card.score[category] << " ߽ϴ.\n";
+    }
+
+    cout << "\n ! : " << card.Total() << "\n";
+}
+
+// 0 ̻ 10  (ڿ ü ڿ Ѵ)
+bool parseCount(const char* s, uint64_t& out) {
+    if (!isdigit((unsigned char)s[0])) return false;
+    char* end;
+    errno = 0;
+    unsigned long long v = strtoull(s, &end, 10);
+    if (*end || errno == ERANGE) return false;
+    out = v;
+    return true;
+}
+
+// 帮 ùķ̼: yacht_rule --simulate [ ] [--policy greedy|lookahead|optimal]
+//                                   [--threads N] [--seed S] [--strategy ]
+//  - 𸣴 ɼ̳ ߸    ϰ 1
+int runSimulation(int argc, char** argv) {
+    uint64_t games = 1000000;
+    uint64_t seed = 1;
+    int threads = 0;
+    string policyName = "optimal";
+    const char* strategyPath = "yacht_strategy.bin";
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        bool ok = true;
+        uint64_t n = 0;
+        if (!strcmp(argv[i], "--simulate")) {
+            //     ( ڰ ɼ̸ ⺻)
+            if (hasValue && argv[i + 1][0] != '-') ok = parseCount(argv[++i], games);
+        }
+        else if (!strcmp(argv[i], "--policy") && hasValue) policyName = argv[++i];
+        else if (!strcmp(argv[i], "--threads") && hasValue) {
+            ok = parseCount(argv[++i], n) && n <= (uint64_t)numeric_limits<int>::max();
+            threads = (int)n;
+        }
+        else if (!strcmp(argv[i], "--seed") && hasValue) ok = parseCount(argv[++i], seed);
+        else if (!strcmp(argv[i], "--strategy") && hasValue) strategyPath = argv[++i];
+        else ok = false;
+
+        if (!ok) {
+            cerr << "Invalid argument: " << argv[i] << endl;
+            cerr << "usage: yacht_rule --simulate [games] [--policy greedy|lookahead|optimal]"
+                    " [--threads N] [--seed S] [--strategy file]" << endl;
+            return 1;
+        }
+    }
 
-        while (card.used[choice - 1]) {
-            cout << "̹  ׸Դϴ. ٽ : ";
-            cin >> choice;
-            cin.ignore();
+    if (games == 0) {
+        cerr << "Number of games must be at least 1" << endl;
+        return 1;
+    }
+
+    GreedyPolicy greedy;
+    LookaheadPolicy lookahead;
+    MappedStrategy strategy;
+    OptimalPolicy optimal(strategy.view);
+
+    const Policy* policy = nullptr;
+    if (policyName == "greedy") policy = &greedy;
+    else if (policyName == "lookahead") policy = &lookahead;
+    else if (policyName == "optimal") {
+        if (!strategy.Open(strategyPath)) {
+            cerr << "Failed to open strategy table: " << strategyPath << endl;
+            return 1;
         }
+        optimal = OptimalPolicy(strategy.view);
+        policy = &optimal;
+    }
+    else {
+        cerr << "Unknown policy: " << policyName << endl;
+        return 1;
+    }
 
-        string category = categories[choice - 1];
-        int score = calcScore(category, dice);
-        card.scores[category] = score;
-        card.used[choice - 1] = true;
-        cout << category << " " << score << " ߽ϴ.\n";
+    SimulationResult result;
+    Simulate(*policy, games, seed, threads, result);
+
+    printf("policy %s, %llu games in %.3f s (%.0f games/s)\n", policy->Name(),
+        (unsigned long long)result.games, result.seconds, result.seconds > 0 ? result.games / result.seconds : 0.0);
+    printf("mean %.3f  stddev %.3f  min %d  p10 %d  p50 %d  p90 %d  p99 %d  max %d\n",
+        result.Mean(), result.StdDev(), result.Percentile(0.0), result.Percentile(0.10),
+        result.Percentile(0.50), result.Percentile(0.90), result.Percentile(0.99), result.Percentile(1.0));
+
+    for (int c = 0; c < CATCOUNT; c++)
+        printf("  %-12s %7.3f\n", CATEGORY_NAMES[c], (double)result.categorySum[c] / result.games);
+
+    // 10  
+    const int BUCKET = 10;
+    uint64_t peak = 1, bucket[MAX_GAME_SCORE / BUCKET + 1] = {};
+    for (int i = 0; i <= MAX_GAME_SCORE; i++) bucket[i / BUCKET] += result.histogram[i];
+    for (uint64_t b : bucket) peak = max(peak, b);
+    for (int b = 0; b <= MAX_GAME_SCORE / BUCKET; b++) {
+        if (!bucket[b]) continue;
+        printf("%3d-%3d %10llu ", b * BUCKET, b * BUCKET + BUCKET - 1, (unsigned long long)bucket[b]);
+        for (uint64_t n = 0; n < bucket[b] * 50 / peak; n++) putchar('#');
+        putchar('\n');
     }
+    return 0;
+}
 
-    int total = 0;
-    for (auto& s : card.scores) total += s.second;
-    cout << "\n ! : " << total << "\n";
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++)
+        if (!strcmp(argv[i], "--simulate")) return runSimulation(argc, argv);
+
+    playInteractive();
+    return 0;
 }
@@ -0,0 +1,91 @@
+﻿#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <string>
+
+#include "../../../Common/YachtSolver.h"
+
+using namespace std;
+
+// 1인 요트 최적 전략 계산 후 저장
+//  사용법: yacht_solver [출력 파일] [-t 스레드 수] [--game] [--scale]
+//    -t      : 풀이 스레드 수 (기본 = 하드웨어 스레드 수)
+//    --game  : GL 게임 규칙 (나눠 준 뒤 MAX_ROLLS 번 다시 굴리기) 으로 풀기
+//              기본 출력 파일 yacht_strategy_game.bin (콘솔 규칙은 yacht_strategy.bin)
+//    --scale : 1, 2, 4, ... 스레드로 각각 풀어 처리량과 확장 효율 출력
+
+double stateCount(int stages) {
+    return (double)MASK_COUNT * stages * HAND_COUNT;
+}
+
+double timedSolve(StrategyTable& table, int threads, int stages) {
+    auto t0 = chrono::steady_clock::now();
+    SolveStrategy(table, threads, stages);
+    auto t1 = chrono::steady_clock::now();
+    return chrono::duration<double>(t1 - t0).count();
+}
+
+void runScaling(int maxThreads, int stages) {
+    printf("%8s %10s %14s %9s %11s\n", "threads", "time(s)", "states/s", "speedup", "efficiency");
+
+    double base = 0;
+    for (int t = 1; ; t *= 2) {
+        if (t > maxThreads) t = maxThreads;
+
+        StrategyTable table;
+        double sec = timedSolve(table, t, stages);
+        if (t == 1) base = sec;
+
+        double speedup = base / sec;
+        printf("%8d %10.3f %14.0f %8.2fx %10.1f%%\n", t, sec, stateCount(stages) / sec, speedup, 100.0 * speedup / t);
+        if (t == maxThreads) break;
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    int threads = (int)thread::hardware_concurrency();
+    bool scale = false;
+    int stages = STAGE_COUNT;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-t") && i + 1 < argc) threads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--game")) stages = GAME_STAGE_COUNT;
+        else if (!strcmp(argv[i], "--scale")) scale = true;
+        else if (argv[i][0] != '-') path = argv[i];
+        else {
+            bool help = !strcmp(argv[i], "-h") || !strcmp(argv[i], "--help");
+            if (!help) cerr << "Unknown option: " << argv[i] << endl;
+            (help ? cout : cerr) << "usage: yacht_solver [output file] [-t threads] [--game] [--scale]" << endl;
+            return help ? 0 : 1;
+        }
+    }
+    if (threads < 1) threads = 1;
+    if (!path) path = stages == GAME_STAGE_COUNT ? "yacht_strategy_game.bin" : "yacht_strategy.bin";
+
+    if (scale) {
+        runScaling(threads, stages);
+        return 0;
+    }
+
+    StrategyTable table;
+    double sec = timedSolve(table, threads, stages);
+    printf("solved %d masks with %d thread(s) in %.3f s (%.0f states/s), expected score %.4f\n",
+        MASK_COUNT, threads, sec, stateCount(stages) / sec, table.ExpectedScore());
+
+    if (!SaveStrategy(table, path)) {
+        cerr << "Failed to write strategy table: " << path << endl;
+        return 1;
+    }
+    printf("wrote %s\n", path);
+
+    MappedStrategy check;
+    if (!check.Open(path, stages)
+        || memcmp(check.view.policy, table.policy.data(), table.policy.size()) != 0) {
+        cerr << "Strategy table read-back mismatch: " << path << endl;
+        return 1;
+    }
+    return 0;
+}
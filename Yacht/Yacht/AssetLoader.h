@@ -0,0 +1,226 @@
+﻿#pragma once
+#include <gl/glew.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MeshCache.h"
+#include "TextureCache.h"
+
+// =============================================================
+// CPU 쪽 에셋 (작업 스레드에서 읽는다, GL 호출 없음)
+// =============================================================
+
+// 메시: 캐시가 맞으면 매핑, 아니면 OBJ 를 읽고 캐시를 만든다
+struct MeshAsset
+{
+    MappedMesh            mapped;
+    std::vector<float>    verts;
+    std::vector<uint32_t> indices;
+    std::vector<uint16_t> indices16;   // 정점이 적으면 캐시와 같이 16비트로 줄여서 올린다
+    MeshView              view;
+
+    bool Load(const char* path)
+    {
+        std::string cache = MeshCachePath(path);
+        if (mapped.Open(cache.c_str(), path))
+        {
+            view = mapped.view;
+            return true;
+        }
+
+        if (!LoadObj(path, verts, indices))
+            return false;
+
+        if (!SaveMeshCache(cache.c_str(), path, verts, indices))
+            std::cerr << "Failed to write mesh cache: " << cache << std::endl;
+
+        SetObjLayout(view);
+        view.vertices = verts.data();
+        view.vertexCount = (uint32_t)(verts.size() / 5);
+        view.indexCount = (uint32_t)indices.size();
+        view.indexStride = IndexStrideFor(view.vertexCount);
+        if (view.indexStride == 2)
+        {
+            indices16.assign(indices.begin(), indices.end());
+            view.indices = indices16.data();
+        }
+        else
+            view.indices = indices.data();
+        return true;
+    }
+};
+
+// 이미지: 밉맵 캐시가 맞으면 매핑, 아니면 PNG 를 디코딩해 밉맵을 만들고 캐시 저장
+struct ImageAsset
+{
+    MappedTexture        mapped;
+    std::vector<uint8_t> chain;
+    TextureView          view;
+
+    bool Load(const char* path)
+    {
+        std::string cache = TextureCachePath(path);
+        if (mapped.Open(cache.c_str(), path))
+        {
+            view = mapped.view;
+            return true;
+        }
+
+        if (!DecodeMipChain(path, chain, view))
+        {
+            std::cerr << "Failed to load texture: " << path << std::endl;
+            return false;
+        }
+        if (!SaveTextureCache(cache.c_str(), path, view))
+            std::cerr << "Failed to write texture cache: " << cache << std::endl;
+        return true;
+    }
+};
+
+// =============================================================
+// 텍스처 올리기 (GL 스레드)
+//  - img 의 픽셀(매핑된 캐시 또는 디코딩한 밉맵)에서 바로 glTexImage2D
+//    => 중간 버퍼로 한 번 더 복사하지 않는다
+//  - tex 는 이미 만들어 둔 텍스처 (자리 표시 텍스처를 그대로 덮어쓴다)
+// =============================================================
+inline void UploadTexture(GLuint tex, const TextureView& img)
+{
+    // 밉맵은 캐시에 이미 있으므로 단계별로 그대로 올린다
+    glBindTexture(GL_TEXTURE_2D, tex);
+    for (uint32_t l = 0; l < img.levelCount; l++)
+    {
+        const TextureLevel& lv = img.levels[l];
+        glTexImage2D(GL_TEXTURE_2D, l, GL_RGBA, lv.width, lv.height, 0,
+            GL_RGBA, GL_UNSIGNED_BYTE, img.data + lv.offset);
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, img.levelCount - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
+
+// 에셋이 올 때까지 쓸 1x1 텍스처
+inline GLuint CreatePlaceholderTexture(unsigned char r, unsigned char g, unsigned char b)
+{
+    const unsigned char px[4] = { r, g, b, 255 };
+    GLuint tex;
+    glGenTextures(1, &tex);
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, px);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    return tex;
+}
+
+// =============================================================
+// 비동기 에셋 로더
+//  - 작업 스레드 풀에서 파일 읽기 / 디코딩 / 파싱
+//  - 끝난 결과는 완료 목록에 쌓였다가, GL 스레드가 매 프레임 Poll() 로
+//    꺼내 올린다 (GL 호출은 항상 GL 스레드에서만)
+//  - 첫 프레임까지 시간 = 가장 느린 에셋 하나 (전부의 합이 아니라)
+// =============================================================
+struct AssetLoader
+{
+    std::vector<std::thread>           workers;
+    std::mutex                         jobMutex;
+    std::condition_variable            jobReady;
+    std::deque<std::function<void()>>  jobs;
+    bool                               stopping = false;
+
+    std::mutex                         doneMutex;
+    std::vector<std::function<void()>> done;       // GL 스레드에서 실행할 올리기 작업
+    std::atomic<int>                   pending{ 0 };
+
+    ~AssetLoader() { Stop(); }
+
+    // threads <= 0 이면 하드웨어 스레드 수 - 1 (최소 1)
+    void Start(int threads = 0)
+    {
+        if (!workers.empty()) return;
+        if (threads <= 0) threads = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+        stopping = false;
+        for (int i = 0; i < threads; i++)
+            workers.emplace_back([this]() { WorkerLoop(); });
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(jobMutex);
+            stopping = true;
+        }
+        jobReady.notify_all();
+        for (std::thread& t : workers) t.join();
+        workers.clear();
+    }
+
+    // load 는 작업 스레드에서 T 를 채우고, 성공하면 upload(T&) 를 GL 스레드에서 호출
+    template <class T>
+    void Load(std::string path, std::function<void(T&)> upload)
+    {
+        pending++;
+        auto job = [this, path, upload]() {
+            auto asset = std::make_shared<T>();
+            bool ok = asset->Load(path.c_str());
+
+            std::lock_guard<std::mutex> lock(doneMutex);
+            done.push_back([this, ok, asset, upload]() {
+                if (ok) upload(*asset);
+                pending--;
+            });
+        };
+        {
+            std::lock_guard<std::mutex> lock(jobMutex);
+            jobs.push_back(job);
+        }
+        jobReady.notify_one();
+    }
+
+    // GL 스레드에서 매 프레임. 올린 에셋 수를 돌려준다
+    int Poll()
+    {
+        std::vector<std::function<void()>> ready;
+        {
+            std::lock_guard<std::mutex> lock(doneMutex);
+            ready.swap(done);
+        }
+        for (auto& f : ready) f();
+        return (int)ready.size();
+    }
+
+    bool IsIdle() const { return pending == 0; }
+
+    // 올릴 에셋이 기다리고 있는지 (다음 Poll() 에 할 일이 있는지)
+    bool HasDone()
+    {
+        std::lock_guard<std::mutex> lock(doneMutex);
+        return !done.empty();
+    }
+
+    void WorkerLoop()
+    {
+        while (true)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(jobMutex);
+                jobReady.wait(lock, [this]() { return stopping || !jobs.empty(); });
+                if (stopping) return;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            job();
+        }
+    }
+};
@@ -0,0 +1,58 @@
+﻿#pragma once
+#include <algorithm>
+#include <chrono>
+
+// =============================================================
+// 프레임 시계
+//  - steady_clock (단조 증가, 고해상도) 로 지난 Tick() 이후 흐른 시간을 잰다
+//  - GLUT 타이머가 늦게 불려도 실제 흐른 시간만큼 시뮬레이션이 진행된다
+//  - 한 번에 maxDelta 보다 많이는 넘기지 않는다 (중단점, 창 끌기 등)
+// =============================================================
+struct FrameClock
+{
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point last = Clock::now();
+    double            maxDelta = 0.25;    // 초
+
+    // 지금부터 다시 잰다 (멈춰 있다가 애니메이션을 시작할 때)
+    void Reset() { last = Clock::now(); }
+
+    // 지난 Tick() 이후 흐른 초
+    double Tick()
+    {
+        Clock::time_point now = Clock::now();
+        double dt = std::chrono::duration<double>(now - last).count();
+        last = now;
+        return std::min(dt, maxDelta);
+    }
+};
+
+// =============================================================
+// 고정 간격 시뮬레이션 누산기
+//  - 흐른 시간을 쌓아 두고 step 단위로만 시뮬레이션을 진행한다
+//    => 그리는 빈도와 상관없이 같은 결과 (프레임이 늦어도 ROLL_DUR 그대로)
+//  - 남은 시간 비율 Alpha() 로 직전 / 현재 상태를 보간해 그린다
+//  - dt 를 직접 넣으면 실제 시간과 무관하게 돌릴 수 있다 (헤드리스 테스트)
+// =============================================================
+struct FixedStep
+{
+    double step;
+    double accumulator = 0.0;
+
+    explicit FixedStep(double step_) : step(step_) {}
+
+    void Reset() { accumulator = 0.0; }
+
+    // dt 를 쌓고, 이번에 진행할 step 수를 돌려준다
+    int Advance(double dt)
+    {
+        accumulator += dt;
+        int n = (int)(accumulator / step);
+        accumulator -= n * step;
+        return n;
+    }
+
+    // 0 = 직전 step 상태, 1 = 현재 step 상태
+    float Alpha() const { return (float)(accumulator / step); }
+};
@@ -0,0 +1,187 @@
+﻿#pragma once
+#include <gl/glew.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+// =============================================================
+// 프레임 단계별 시간 측정 (벤치마크: yacht --headless --bench)
+//  - CPU: 단계 경계마다 steady_clock
+//  - GPU: 단계 경계마다 GL_TIMESTAMP 쿼리 (GL 3.3 / ARB_timer_query)
+//    결과는 PROFILER_LATENCY 프레임 뒤에 읽는다 => 측정 때문에 파이프라인이 멈추지 않음
+//  - 끄면 (enabled = false) Mark 는 아무것도 하지 않는다
+// =============================================================
+enum FramePhase : int
+{
+    PHASE_SCOREBOARD,   // 점수판 텍스처 (내용이 바뀐 프레임만 다시 그린다)
+    PHASE_SCENE,        // 3D: 바닥, 트레이, 주사위
+    PHASE_LABELS,       // 주사위 숫자 (글자 쌓기)
+    PHASE_OVERLAY,      // 점수판 붙이기 + 쌓은 글자 그리기 (gText.Flush)
+    PHASE_FINISH,       // 스왑 / glFinish 대기
+    PHASE_COUNT
+};
+
+inline constexpr const char* PHASE_NAMES[PHASE_COUNT + 1] = {
+    "scoreboard", "scene", "labels", "overlay", "finish", "frame"
+};
+
+constexpr int PROFILER_LATENCY = 3;
+
+// 정렬 후 가장 가까운 순위 (p = 0~100)
+inline double Percentile(const std::vector<double>& sorted, double p)
+{
+    if (sorted.empty()) return 0.0;
+    size_t rank = (size_t)std::ceil(p / 100.0 * sorted.size());
+    return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+struct PhaseStats
+{
+    double mean = 0, p50 = 0, p95 = 0, p99 = 0, max = 0;
+    size_t count = 0;
+};
+
+struct FrameProfiler
+{
+    using Clock = std::chrono::steady_clock;
+    using Sample = std::array<double, PHASE_COUNT + 1>;   // 단계별 ms + 프레임 전체
+
+    bool enabled = false;
+    bool gpuTimers = false;
+
+    std::vector<Sample> cpu, gpu;     // 프레임마다 하나 (gpu 는 NaN = 아직 / 없음)
+
+    Clock::time_point marks[PHASE_COUNT + 1];
+    GLuint queries[PROFILER_LATENCY][PHASE_COUNT + 1] = {};
+    int    pending[PROFILER_LATENCY] = { -1, -1, -1 };     // 슬롯이 기다리는 프레임 번호
+
+    void Start(bool useGpu)
+    {
+        enabled = true;
+        GLint major = 0, minor = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        gpuTimers = useGpu && (major > 3 || (major == 3 && minor >= 3));
+        if (gpuTimers)
+            glGenQueries(PROFILER_LATENCY * (PHASE_COUNT + 1), &queries[0][0]);
+    }
+
+    void BeginFrame()
+    {
+        if (!enabled) return;
+        int slot = (int)cpu.size() % PROFILER_LATENCY;
+        if (gpuTimers)
+        {
+            Collect(slot);
+            glQueryCounter(queries[slot][0], GL_TIMESTAMP);
+        }
+        marks[0] = Clock::now();
+    }
+
+    // phase 가 끝난 시점
+    void Mark(FramePhase phase)
+    {
+        if (!enabled) return;
+        marks[phase + 1] = Clock::now();
+        if (gpuTimers)
+            glQueryCounter(queries[cpu.size() % PROFILER_LATENCY][phase + 1], GL_TIMESTAMP);
+    }
+
+    void EndFrame()
+    {
+        if (!enabled) return;
+        Sample s;
+        for (int p = 0; p < PHASE_COUNT; p++)
+            s[p] = std::chrono::duration<double, std::milli>(marks[p + 1] - marks[p]).count();
+        s[PHASE_COUNT] = std::chrono::duration<double, std::milli>(marks[PHASE_COUNT] - marks[0]).count();
+
+        if (gpuTimers) pending[cpu.size() % PROFILER_LATENCY] = (int)cpu.size();
+        cpu.push_back(s);
+        Sample none;
+        none.fill(std::numeric_limits<double>::quiet_NaN());
+        gpu.push_back(none);
+    }
+
+    // 남은 GPU 결과를 모두 읽는다 (측정이 끝난 뒤)
+    void Finish()
+    {
+        if (!gpuTimers) return;
+        for (int slot = 0; slot < PROFILER_LATENCY; slot++) Collect(slot);
+        glDeleteQueries(PROFILER_LATENCY * (PHASE_COUNT + 1), &queries[0][0]);
+        gpuTimers = false;
+    }
+
+    void Collect(int slot)
+    {
+        int f = pending[slot];
+        if (f < 0) return;
+        pending[slot] = -1;
+
+        GLuint64 ts[PHASE_COUNT + 1];
+        for (int i = 0; i <= PHASE_COUNT; i++)
+            glGetQueryObjectui64v(queries[slot][i], GL_QUERY_RESULT, &ts[i]);
+        for (int p = 0; p < PHASE_COUNT; p++)
+            gpu[f][p] = (double)(ts[p + 1] - ts[p]) * 1e-6;
+        gpu[f][PHASE_COUNT] = (double)(ts[PHASE_COUNT] - ts[0]) * 1e-6;
+    }
+
+    // 앞의 warmup 프레임은 빼고 (셰이더 / 텍스처 첫 사용 비용)
+    static PhaseStats Summarize(const std::vector<Sample>& samples, int phase, size_t warmup)
+    {
+        std::vector<double> v;
+        for (size_t f = warmup; f < samples.size(); f++)
+            if (!std::isnan(samples[f][phase])) v.push_back(samples[f][phase]);
+
+        PhaseStats st;
+        st.count = v.size();
+        if (v.empty()) return st;
+        std::sort(v.begin(), v.end());
+        for (double x : v) st.mean += x;
+        st.mean /= v.size();
+        st.p50 = Percentile(v, 50);
+        st.p95 = Percentile(v, 95);
+        st.p99 = Percentile(v, 99);
+        st.max = v.back();
+        return st;
+    }
+
+    void Print(size_t warmup) const
+    {
+        printf("%-11s %9s %8s %8s %8s  |%8s %8s %8s %8s\n", "phase (ms)",
+            "cpu mean", "p50", "p95", "p99", "gpu mean", "p50", "p95", "p99");
+        for (int p = 0; p <= PHASE_COUNT; p++)
+        {
+            PhaseStats c = Summarize(cpu, p, warmup), g = Summarize(gpu, p, warmup);
+            printf("%-11s %9.3f %8.3f %8.3f %8.3f  |", PHASE_NAMES[p], c.mean, c.p50, c.p95, c.p99);
+            if (g.count) printf("%8.3f %8.3f %8.3f %8.3f\n", g.mean, g.p50, g.p95, g.p99);
+            else         printf("%8s %8s %8s %8s\n", "-", "-", "-", "-");
+        }
+    }
+
+    // "cpu_ms": { "scene": {...}, ... }, "gpu_ms": {...} (GPU 타이머가 없으면 null)
+    void WriteJson(FILE* f, size_t warmup) const
+    {
+        for (int which = 0; which < 2; which++)
+        {
+            const std::vector<Sample>& samples = which ? gpu : cpu;
+            fprintf(f, "  \"%s\": ", which ? "gpu_ms" : "cpu_ms");
+            if (which && Summarize(gpu, PHASE_COUNT, warmup).count == 0) {
+                fprintf(f, "null\n");
+                continue;
+            }
+            fprintf(f, "{\n");
+            for (int p = 0; p <= PHASE_COUNT; p++)
+            {
+                PhaseStats st = Summarize(samples, p, warmup);
+                fprintf(f, "    \"%s\": { \"mean\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }%s\n",
+                    PHASE_NAMES[p], st.mean, st.p50, st.p95, st.p99, st.max, p < PHASE_COUNT ? "," : "");
+            }
+            fprintf(f, "  }%s\n", which ? "" : ",");
+        }
+    }
+};
@@ -0,0 +1,202 @@
+﻿#pragma once
+#include <gl/glew.h>
+
+#if defined(_WIN32)
+#include <gl/freeglut.h>
+#else
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// =============================================================
+// 헤드리스 GL 컨텍스트 (창 없이 그리기: CI 벤치마크 / 골든 이미지 비교)
+//  - 리눅스: EGL surfaceless (Mesa llvmpipe 면 GPU / 디스플레이 없이 동작)
+//      빌드할 때 -lEGL 추가
+//  - 윈도우: 숨긴 GLUT 창의 컨텍스트를 빌려 쓴다 (그리기는 어차피 FBO 로)
+//  - 컨텍스트는 GLUT 기본과 같은 호환 프로파일 3.3
+// =============================================================
+struct HeadlessContext
+{
+#if defined(_WIN32)
+    int window = 0;
+#else
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+#endif
+
+    bool Create(int& argc, char** argv)
+    {
+#if defined(_WIN32)
+        glutInit(&argc, argv);
+        glutInitDisplayMode(GLUT_RGBA);
+        glutInitWindowSize(1, 1);
+        window = glutCreateWindow("Yacht (headless)");
+        glutHideWindow();
+        return window != 0;
+#else
+        (void)argc; (void)argv;
+
+        display = eglGetPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        if (display == EGL_NO_DISPLAY)
+            display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+            std::cerr << "EGL: no display" << std::endl;
+            return false;
+        }
+        if (!eglBindAPI(EGL_OPENGL_API)) {
+            std::cerr << "EGL: desktop OpenGL not supported" << std::endl;
+            return false;
+        }
+
+        // 기본 프레임버퍼는 쓰지 않으므로 설정 없이 (EGL_KHR_no_config_context)
+        const EGLint attribs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+            EGL_NONE };
+        context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attribs);
+        if (context == EGL_NO_CONTEXT
+            || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+            std::cerr << "EGL: context creation failed (0x" << std::hex << eglGetError() << std::dec << ")" << std::endl;
+            return false;
+        }
+        return true;
+#endif
+    }
+
+    void Destroy()
+    {
+#if defined(_WIN32)
+        if (window) glutDestroyWindow(window);
+        window = 0;
+#else
+        if (display == EGL_NO_DISPLAY) return;
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (context != EGL_NO_CONTEXT) eglDestroyContext(display, context);
+        eglTerminate(display);
+        display = EGL_NO_DISPLAY;
+        context = EGL_NO_CONTEXT;
+#endif
+    }
+};
+
+// =============================================================
+// 오프스크린 렌더 타깃 (색 RGBA8 + 깊이 24)
+//  - Bind() 해 두면 Display 와 같은 그리기가 창 대신 여기로 간다
+// =============================================================
+struct RenderTarget
+{
+    GLuint fbo = 0, color = 0, depth = 0;
+    int    width = 0, height = 0;
+
+    bool Create(int w, int h)
+    {
+        width = w;
+        height = h;
+
+        glGenRenderbuffers(1, &color);
+        glBindRenderbuffer(GL_RENDERBUFFER, color);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, w, h);
+
+        glGenRenderbuffers(1, &depth);
+        glBindRenderbuffer(GL_RENDERBUFFER, depth);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, w, h);
+
+        glGenFramebuffers(1, &fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+
+        GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        if (status != GL_FRAMEBUFFER_COMPLETE) {
+            std::cerr << "Framebuffer incomplete: 0x" << std::hex << status << std::dec << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    void Bind() const { glBindFramebuffer(GL_FRAMEBUFFER, fbo); }
+
+    // 위쪽 행부터 RGB (이미지 파일 순서)
+    void Read(std::vector<uint8_t>& rgb) const
+    {
+        size_t row = (size_t)width * 3;
+        std::vector<uint8_t> gl(row * height);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, gl.data());
+
+        rgb.resize(gl.size());
+        for (int y = 0; y < height; y++)
+            memcpy(&rgb[y * row], &gl[(height - 1 - y) * row], row);
+    }
+
+    void Destroy()
+    {
+        glDeleteFramebuffers(1, &fbo);
+        GLuint rbs[2] = { color, depth };
+        glDeleteRenderbuffers(2, rbs);
+        fbo = color = depth = 0;
+    }
+};
+
+// =============================================================
+// 프레임 저장 / 비교 (PPM: 헤더 한 줄 + RGB, 어떤 이미지 도구로도 열린다)
+// =============================================================
+inline bool WritePPM(const char* path, int w, int h, const std::vector<uint8_t>& rgb)
+{
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", w, h);
+    bool ok = fwrite(rgb.data(), 1, rgb.size(), f) == rgb.size();
+    return fclose(f) == 0 && ok;
+}
+
+inline bool ReadPPM(const char* path, int& w, int& h, std::vector<uint8_t>& rgb)
+{
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+
+    int maxval = 0;
+    bool ok = fscanf(f, "P6 %d %d %d", &w, &h, &maxval) == 3 && maxval == 255 && w > 0 && h > 0
+        && fgetc(f) != EOF;     // 헤더 끝 공백 한 글자
+    if (ok)
+    {
+        rgb.resize((size_t)w * h * 3);
+        ok = fread(rgb.data(), 1, rgb.size(), f) == rgb.size();
+    }
+    fclose(f);
+    return ok;
+}
+
+struct FrameDiff
+{
+    long pixels = 0;      // 채널 차이가 tolerance 를 넘는 픽셀 수 (크기가 다르면 -1)
+    int  maxDelta = 0;    // 가장 큰 채널 차이
+};
+
+inline FrameDiff DiffFrames(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, int tolerance)
+{
+    FrameDiff d;
+    if (a.size() != b.size()) {
+        d.pixels = -1;
+        return d;
+    }
+    for (size_t i = 0; i < a.size(); i += 3)
+    {
+        int m = 0;
+        for (int c = 0; c < 3; c++)
+            m = std::max(m, std::abs((int)a[i + c] - (int)b[i + c]));
+        d.maxDelta = std::max(d.maxDelta, m);
+        if (m > tolerance) d.pixels++;
+    }
+    return d;
+}
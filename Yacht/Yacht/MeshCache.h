@@ -0,0 +1,226 @@
+﻿#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "ObjLoader.h"
+#include "../../Common/YachtMappedFile.h"
+
+// =============================================================
+// 바이너리 메시 캐시 (<obj>.ymesh)
+//  - 처음 OBJ 를 읽을 때 자동으로 만들고, 다음 실행부터는 매핑해서
+//    정점 / 인덱스 배열을 그대로 glBufferData 에 넘긴다 (파싱 없음)
+//  - 원본 OBJ 의 크기 + 수정 시각이 같으면 바로 사용,
+//    다르면 원본 해시(FNV-1a)까지 비교해 내용이 같을 때만 사용
+//  - 원본이 없으면 (캐시만 배포한 경우) 캐시를 그대로 믿는다
+//  - 헤더와 정점 / 인덱스 배열에 FNV-1a 체크섬 (전략 파일과 같은 방식)
+//    인덱스가 정점 수를 넘으면 거부 => 깨진 캐시가 GL 로 넘어가지 않는다
+//
+//  [헤더][정점 배열 (64바이트 정렬)][인덱스 배열 (64바이트 정렬)]
+// =============================================================
+constexpr uint32_t MESH_FILE_VERSION = 2;
+constexpr size_t   MESH_ALIGN = 64;
+constexpr int      MESH_MAX_ATTRIBS = 4;
+
+// 정점 속성 하나 (float 만 사용)
+struct MeshAttrib
+{
+    uint32_t location;
+    uint32_t components;
+    uint32_t offset;      // 정점 안에서 바이트 위치
+};
+
+struct MeshFileHeader
+{
+    char       magic[4];          // "YMSH"
+    uint32_t   version;
+    uint32_t   headerSize;
+    uint32_t   vertexCount;
+    uint32_t   indexCount;
+    uint32_t   indexStride;       // 2 또는 4
+    uint32_t   stride;
+    uint32_t   attribCount;
+    MeshAttrib attribs[MESH_MAX_ATTRIBS];
+    uint64_t   sourceSize;
+    int64_t    sourceTime;        // 원본 수정 시각 (file_time 틱)
+    uint64_t   sourceHash;        // 원본 전체 FNV-1a
+    uint64_t   vertexOffset, vertexSize;
+    uint64_t   indexOffset, indexSize;
+    uint64_t   vertexChecksum;
+    uint64_t   indexChecksum;
+    uint64_t   headerChecksum;    // 이 필드를 0 으로 두고 계산
+};
+
+// 메모리에 있는 메시 (매핑된 캐시이든 방금 읽은 OBJ 이든)
+struct MeshView
+{
+    const void* vertices = nullptr;
+    const void* indices = nullptr;
+    uint32_t    vertexCount = 0;
+    uint32_t    indexCount = 0;
+    uint32_t    indexStride = 4;    // 2 또는 4
+    uint32_t    stride = 0;
+    uint32_t    attribCount = 0;
+    MeshAttrib  attribs[MESH_MAX_ATTRIBS] = {};
+};
+
+// LoadObj 출력 형식: pos 3 + uv 2
+inline void SetObjLayout(MeshView& v)
+{
+    v.stride = sizeof(float) * 5;
+    v.attribCount = 2;
+    v.attribs[0] = { 0, 3, 0 };
+    v.attribs[1] = { 1, 2, sizeof(float) * 3 };
+}
+
+inline uint64_t MeshHeaderChecksum(MeshFileHeader hdr)
+{
+    hdr.headerChecksum = 0;
+    return Fnv1a64(&hdr, sizeof(hdr));
+}
+
+inline std::string MeshCachePath(const char* objPath)
+{
+    return std::string(objPath) + ".ymesh";
+}
+
+// 정점 65536개 미만이면 16비트 인덱스 (캐시 파일이든 OBJ 를 바로 올리든)
+inline uint32_t IndexStrideFor(uint32_t vertexCount)
+{
+    return vertexCount <= 0xFFFF ? 2 : 4;
+}
+
+inline bool SaveMeshCache(const char* cachePath, const char* objPath,
+    const std::vector<float>& verts, const std::vector<uint32_t>& indices)
+{
+    MeshView layout;
+    SetObjLayout(layout);
+
+    MeshFileHeader hdr = {};
+    hdr.magic[0] = 'Y'; hdr.magic[1] = 'M'; hdr.magic[2] = 'S'; hdr.magic[3] = 'H';
+    hdr.version = MESH_FILE_VERSION;
+    hdr.headerSize = sizeof(hdr);
+    hdr.stride = layout.stride;
+    hdr.vertexCount = (uint32_t)(verts.size() * sizeof(float) / layout.stride);
+    hdr.indexCount = (uint32_t)indices.size();
+    hdr.indexStride = IndexStrideFor(hdr.vertexCount);
+    hdr.attribCount = layout.attribCount;
+    memcpy(hdr.attribs, layout.attribs, sizeof(hdr.attribs));
+    if (!SourceStamp(objPath, hdr.sourceSize, hdr.sourceTime)) return false;
+    hdr.sourceHash = SourceHash(objPath);
+    hdr.vertexOffset = AlignUp(sizeof(hdr), MESH_ALIGN);
+    hdr.vertexSize = verts.size() * sizeof(float);
+    hdr.indexOffset = AlignUp(hdr.vertexOffset + hdr.vertexSize, MESH_ALIGN);
+    hdr.indexSize = (uint64_t)hdr.indexCount * hdr.indexStride;
+
+    std::vector<uint16_t> idx16;
+    const void* idx = indices.data();
+    if (hdr.indexStride == 2)
+    {
+        idx16.assign(indices.begin(), indices.end());
+        idx = idx16.data();
+    }
+    hdr.vertexChecksum = Fnv1a64(verts.data(), hdr.vertexSize);
+    hdr.indexChecksum = Fnv1a64(idx, hdr.indexSize);
+    hdr.headerChecksum = MeshHeaderChecksum(hdr);
+
+    // 쓰다 실패해도 반쪽 파일이 남지 않게 임시 파일에 쓰고 이름을 바꾼다
+    std::string tmp = TempPathFor(cachePath);
+    std::ofstream f(tmp, std::ios::binary);
+    if (!f.is_open()) return false;
+
+    static const char pad[MESH_ALIGN] = {};
+    f.write((const char*)&hdr, sizeof(hdr));
+    f.write(pad, hdr.vertexOffset - sizeof(hdr));
+    f.write((const char*)verts.data(), hdr.vertexSize);
+    f.write(pad, hdr.indexOffset - (hdr.vertexOffset + hdr.vertexSize));
+    f.write((const char*)idx, hdr.indexSize);
+    return CommitTempFile(f, tmp, cachePath);
+}
+
+// 모든 인덱스가 정점 수보다 작은지
+inline bool IndicesInRange(const void* indices, uint32_t count, uint32_t stride, uint32_t vertexCount)
+{
+    uint32_t top = 0;
+    if (stride == 2)
+        for (uint32_t i = 0; i < count; i++) top = std::max<uint32_t>(top, ((const uint16_t*)indices)[i]);
+    else
+        for (uint32_t i = 0; i < count; i++) top = std::max(top, ((const uint32_t*)indices)[i]);
+    return count == 0 || top < vertexCount;
+}
+
+// 매핑된 메시 캐시 (내용은 view 로)
+struct MappedMesh
+{
+    MappedFile file;
+    MeshView   view;
+
+    // objPath 가 있으면 원본과 맞는지 확인 (nullptr 이면 확인 안 함)
+    bool Open(const char* cachePath, const char* objPath)
+    {
+        view = MeshView();
+        if (!file.Open(cachePath)) return false;
+
+        MeshFileHeader hdr;
+        if (file.size < sizeof(hdr)) return Fail();
+        memcpy(&hdr, file.data, sizeof(hdr));
+
+        if (hdr.magic[0] != 'Y' || hdr.magic[1] != 'M' || hdr.magic[2] != 'S' || hdr.magic[3] != 'H'
+            || hdr.version != MESH_FILE_VERSION || hdr.headerSize != sizeof(hdr)
+            || hdr.headerChecksum != MeshHeaderChecksum(hdr))
+            return Fail();
+
+        if ((hdr.indexStride != 2 && hdr.indexStride != 4) || hdr.attribCount > MESH_MAX_ATTRIBS
+            || hdr.vertexSize != (uint64_t)hdr.vertexCount * hdr.stride
+            || hdr.indexSize != (uint64_t)hdr.indexCount * hdr.indexStride
+            || hdr.vertexOffset % MESH_ALIGN || hdr.indexOffset % MESH_ALIGN
+            || hdr.vertexOffset + hdr.vertexSize > file.size
+            || hdr.indexOffset + hdr.indexSize > file.size)
+            return Fail();
+
+        const uint8_t* vertices = file.data + hdr.vertexOffset;
+        const uint8_t* indices = file.data + hdr.indexOffset;
+        if (Fnv1a64(vertices, hdr.vertexSize) != hdr.vertexChecksum
+            || Fnv1a64(indices, hdr.indexSize) != hdr.indexChecksum
+            || !IndicesInRange(indices, hdr.indexCount, hdr.indexStride, hdr.vertexCount))
+            return Fail();
+
+        bool restamp;
+        if (!SourceMatches(objPath, hdr.sourceSize, hdr.sourceTime, hdr.sourceHash, restamp))
+            return Fail();
+        if (restamp)
+        {
+            hdr.headerChecksum = MeshHeaderChecksum(hdr);
+            RewriteHeader(cachePath, hdr);
+        }
+
+        view.vertices = vertices;
+        view.indices = indices;
+        view.vertexCount = hdr.vertexCount;
+        view.indexCount = hdr.indexCount;
+        view.indexStride = hdr.indexStride;
+        view.stride = hdr.stride;
+        view.attribCount = hdr.attribCount;
+        memcpy(view.attribs, hdr.attribs, sizeof(view.attribs));
+        return true;
+    }
+
+    bool Fail()
+    {
+        file.Close();
+        return false;
+    }
+};
+
+// OBJ 를 읽어 캐시를 만든다 (오프라인 굽기 / 첫 실행)
+inline bool BakeMesh(const char* objPath)
+{
+    std::vector<float> verts;
+    std::vector<uint32_t> indices;
+    if (!LoadObj(objPath, verts, indices)) return false;
+    return SaveMeshCache(MeshCachePath(objPath).c_str(), objPath, verts, indices);
+}
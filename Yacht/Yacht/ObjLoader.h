@@ -0,0 +1,231 @@
+﻿#pragma once
+#include <charconv>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "../../Common/YachtMappedFile.h"
+
+// =============================================================
+// OBJ Loader
+//  - 파일을 메모리 매핑해 그 자리에서 바로 토큰을 읽는다 (줄 / 토큰 복사 없음)
+//  - 1차: v / vt / 면 꼭짓점 수를 세서 필요한 용량을 정확히 잡는다
+//  - 2차: 값 파싱 + 면 삼각형 분할 + 같은 (위치, uv) 꼭짓점 합치기
+//  - 면 인덱스: v, v/vt, v//vn, v/vt/vn, 음수(뒤에서부터) 모두 지원
+//    (vn 은 정점 형식에 없으므로 읽고 버린다)
+//
+//  출력: verts = 정점마다 float 5개 (pos 3 + uv 2), indices = 삼각형 인덱스
+// =============================================================
+struct ObjCursor
+{
+    const char* p;
+    const char* end;
+
+    bool AtLineEnd() const { return p >= end || *p == '\n' || *p == '\r'; }
+
+    void SkipSpaces()
+    {
+        while (p < end && (*p == ' ' || *p == '\t')) p++;
+    }
+
+    void NextLine()
+    {
+        while (p < end && *p != '\n') p++;
+        if (p < end) p++;
+    }
+
+    // 현재 토큰 건너뛰기
+    void SkipToken()
+    {
+        while (p < end && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r') p++;
+    }
+
+    bool Float(float& v)
+    {
+        SkipSpaces();
+        if (p < end && *p == '+') p++;
+        auto r = std::from_chars(p, end, v);
+        if (r.ec != std::errc()) return false;
+        p = r.ptr;
+        return true;
+    }
+
+    bool Int(int& v)
+    {
+        auto r = std::from_chars(p, end, v);
+        if (r.ec != std::errc()) return false;
+        p = r.ptr;
+        return true;
+    }
+};
+
+// OBJ 인덱스 (1부터, 음수는 현재까지 나온 개수 기준) -> 0부터
+inline int ObjIndex(int i, int count)
+{
+    return i > 0 ? i - 1 : count + i;
+}
+
+inline bool LoadObj(const char* path, std::vector<float>& verts, std::vector<uint32_t>& indices)
+{
+    MappedFile file;
+    if (!file.Open(path)) {
+        std::cerr << "Failed to open OBJ: " << path << std::endl;
+        return false;
+    }
+    const char* begin = (const char*)file.data;
+    const char* end = begin + file.size;
+
+    // ---------- 1차: 개수 세기 ----------
+    size_t posCount = 0, uvCount = 0, triCount = 0, cornerCount = 0;
+    for (ObjCursor c{ begin, end }; c.p < end; c.NextLine())
+    {
+        c.SkipSpaces();
+        if (end - c.p < 2) break;
+        if (c.p[0] == 'v' && (c.p[1] == ' ' || c.p[1] == '\t')) posCount++;
+        else if (c.p[0] == 'v' && c.p[1] == 't') uvCount++;
+        else if (c.p[0] == 'f' && (c.p[1] == ' ' || c.p[1] == '\t'))
+        {
+            c.p++;
+            size_t n = 0;
+            for (c.SkipSpaces(); !c.AtLineEnd(); c.SkipSpaces()) { c.SkipToken(); n++; }
+            if (n >= 3) { triCount += n - 2; cornerCount += n; }
+        }
+    }
+
+    std::vector<float> pos, uv;
+    pos.reserve(posCount * 3);
+    uv.reserve(uvCount * 2);
+    indices.clear();
+    indices.reserve(triCount * 3);
+
+    // (위치 번호, uv 번호 + 1) -> 정점 번호. 열린 주소 해시 (한 번만 할당)
+    size_t cap = 16;
+    while (cap < cornerCount * 2) cap <<= 1;
+    std::vector<uint64_t> slotKey(cap, ~0ull);
+    std::vector<uint32_t> slotVert(cap);
+    std::vector<uint64_t> uniqueKey;
+    uniqueKey.reserve(cornerCount);
+
+    // 표가 가득 차면 ~0u (1차에서 센 꼭짓점 수와 2차가 어긋난 경우)
+    auto vertexOf = [&](int vi, int ti) {
+        uint64_t key = ((uint64_t)(uint32_t)vi << 32) | (uint32_t)(ti + 1);
+        size_t h = (size_t)((key * 0x9E3779B97F4A7C15ull) >> 20) & (cap - 1);
+        for (size_t probe = 0; slotKey[h] != ~0ull; probe++)
+        {
+            if (probe == cap) return ~0u;
+            if (slotKey[h] == key) return slotVert[h];
+            h = (h + 1) & (cap - 1);
+        }
+        slotKey[h] = key;
+        slotVert[h] = (uint32_t)uniqueKey.size();
+        uniqueKey.push_back(key);
+        return slotVert[h];
+    };
+
+    // ---------- 2차: 파싱 ----------
+    std::vector<std::pair<int, int>> face;     // 한 면의 (위치 번호, uv 번호)
+    int line = 0;
+    for (ObjCursor c{ begin, end }; c.p < end; c.NextLine())
+    {
+        line++;
+        c.SkipSpaces();
+        if (end - c.p < 2) break;
+
+        if (c.p[0] == 'v' && (c.p[1] == ' ' || c.p[1] == '\t'))
+        {
+            c.p++;
+            float x, y, z;
+            if (!c.Float(x) || !c.Float(y) || !c.Float(z)) {
+                std::cerr << "OBJ parse error (v): " << path << ":" << line << std::endl;
+                return false;
+            }
+            pos.push_back(x); pos.push_back(y); pos.push_back(z);
+        }
+        else if (c.p[0] == 'v' && c.p[1] == 't')
+        {
+            c.p += 2;
+            float u, v = 0.0f;
+            if (!c.Float(u)) {
+                std::cerr << "OBJ parse error (vt): " << path << ":" << line << std::endl;
+                return false;
+            }
+            c.Float(v);
+            uv.push_back(u); uv.push_back(v);
+        }
+        else if (c.p[0] == 'f' && (c.p[1] == ' ' || c.p[1] == '\t'))
+        {
+            c.p++;
+            int posSoFar = (int)(pos.size() / 3), uvSoFar = (int)(uv.size() / 2);
+            face.clear();
+
+            for (c.SkipSpaces(); !c.AtLineEnd(); c.SkipSpaces())
+            {
+                int v, t = 0, nrm = 0;
+                if (!c.Int(v)) {
+                    std::cerr << "OBJ parse error (f): " << path << ":" << line << std::endl;
+                    return false;
+                }
+                if (c.p < end && *c.p == '/')
+                {
+                    c.p++;
+                    if (c.p < end && *c.p != '/') c.Int(t);
+                    if (c.p < end && *c.p == '/') { c.p++; c.Int(nrm); }
+                }
+                c.SkipToken();
+
+                int vi = ObjIndex(v, posSoFar);
+                int ti = t != 0 ? ObjIndex(t, uvSoFar) : -1;
+                if (vi < 0) {
+                    std::cerr << "OBJ bad index: " << path << ":" << line << std::endl;
+                    return false;
+                }
+                if (ti < 0) ti = -1;
+                face.emplace_back(vi, ti);
+            }
+
+            // 꼭짓점이 3개 미만인 면은 1차에서도 세지 않았으므로 정점도 만들지 않는다
+            if (face.size() < 3) continue;
+
+            // 부채꼴 분할: (첫 꼭짓점, 직전, 현재)
+            uint32_t first = 0, prev = 0;
+            for (size_t k = 0; k < face.size(); k++)
+            {
+                uint32_t cur = vertexOf(face[k].first, face[k].second);
+                if (cur == ~0u) {
+                    std::cerr << "OBJ parse error (f): " << path << ":" << line << std::endl;
+                    return false;
+                }
+                if (k == 0) first = cur;
+                else if (k >= 2) {
+                    indices.push_back(first);
+                    indices.push_back(prev);
+                    indices.push_back(cur);
+                }
+                prev = cur;
+            }
+        }
+    }
+
+    // ---------- 정점 채우기 (앞쪽 참조가 아닌 인덱스도 허용하려고 마지막에) ----------
+    size_t nPos = pos.size() / 3, nUv = uv.size() / 2;
+    verts.assign(uniqueKey.size() * 5, 0.0f);
+    for (size_t i = 0; i < uniqueKey.size(); i++)
+    {
+        uint32_t vi = (uint32_t)(uniqueKey[i] >> 32);
+        int ti = (int)(uint32_t)uniqueKey[i] - 1;
+        if (vi >= nPos) {
+            std::cerr << "OBJ bad index: " << path << std::endl;
+            return false;
+        }
+        float* o = &verts[i * 5];
+        o[0] = pos[vi * 3 + 0];
+        o[1] = pos[vi * 3 + 1];
+        o[2] = pos[vi * 3 + 2];
+        if (ti >= 0 && (size_t)ti < nUv) {
+            o[3] = uv[ti * 2 + 0];
+            o[4] = uv[ti * 2 + 1];
+        }
+    }
+    return !indices.empty();
+}
@@ -0,0 +1,134 @@
+﻿#pragma once
+#include <gl/glew.h>
+#include <gl/glm/glm.hpp>
+#include <gl/glm/gtc/matrix_transform.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "ShaderProgram.h"
+
+// =============================================================
+// 2D 패널 캐시 (텍스처에 그려 두고 매 프레임은 사각형 하나만)
+//  - 내용을 정하는 값(key)과 크기가 지난번과 같으면 다시 그리지 않는다
+//  - Begin() 이 true 면 패널 FBO 가 바인딩된 상태: 내용을 그리고 End()
+//  - Draw() 로 창의 (0, 0) 에 1:1 로 붙인다 (GL_NEAREST, 픽셀 그대로)
+//    붙일 때 쓰는 프로그램은 Init() 에서 받는다 (pos 3 + uv 2, uMVP / uColor / uUseTexture / uTex)
+// =============================================================
+struct PanelCache
+{
+    GLuint fbo = 0, tex = 0;
+    GLuint quadVAO = 0, quadVBO = 0;
+    int    width = 0, height = 0;
+    bool   valid = false;
+    std::vector<uint8_t> key;          // 마지막으로 그린 내용의 key
+    GLint  prevFbo = 0;                // Begin 전에 바인딩돼 있던 FBO (창 = 0, 헤드리스 = 렌더 타깃)
+
+    ShaderProgram* program = nullptr;
+    int uMVP = -1, uColor = -1, uUseTexture = -1, uTex = -1;
+
+    void Init(ShaderProgram& prog)
+    {
+        program = &prog;
+        uMVP = prog.Find("uMVP");
+        uColor = prog.Find("uColor");
+        uUseTexture = prog.Find("uUseTexture");
+        uTex = prog.Find("uTex");
+    }
+
+    // 크기가 바뀌면 텍스처를 다시 만들고, key 가 바뀌었거나 처음이면 FBO 를 바인딩하고 true
+    bool Begin(int w, int h, const void* newKey, size_t keySize)
+    {
+        if (w <= 0 || h <= 0) return false;
+
+        if (w != width || h != height) Resize(w, h);
+        else if (valid && key.size() == keySize && memcmp(key.data(), newKey, keySize) == 0)
+            return false;
+
+        key.assign((const uint8_t*)newKey, (const uint8_t*)newKey + keySize);
+
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &prevFbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glViewport(0, 0, width, height);
+        return true;
+    }
+
+    void End()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, prevFbo);
+        valid = true;
+    }
+
+    void Resize(int w, int h)
+    {
+        width = w;
+        height = h;
+        valid = false;
+
+        if (tex == 0)
+        {
+            glGenTextures(1, &tex);
+            glGenFramebuffers(1, &fbo);
+        }
+        glBindTexture(GL_TEXTURE_2D, tex);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        GLint prev = 0;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &prev);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex, 0);
+        glBindFramebuffer(GL_FRAMEBUFFER, prev);
+    }
+
+    // 단위 사각형 (pos 3 + uv 2, vertex.glsl 배치)
+    void CreateQuad()
+    {
+        const float quad[] = {
+            0, 0, 0,  0, 0,
+            1, 0, 0,  1, 0,
+            1, 1, 0,  1, 1,
+            0, 0, 0,  0, 0,
+            1, 1, 0,  1, 1,
+            0, 1, 0,  0, 1,
+        };
+        glGenVertexArrays(1, &quadVAO);
+        glGenBuffers(1, &quadVBO);
+        glBindVertexArray(quadVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(float) * 5, (void*)0);
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 5, (void*)(sizeof(float) * 3));
+        glBindVertexArray(0);
+    }
+
+    // 창 (windowW x windowH) 의 왼쪽 아래에 패널을 그대로 붙인다. 뷰포트는 창 전체여야 한다
+    void Draw(int windowW, int windowH)
+    {
+        if (!valid || !program) return;
+        if (quadVAO == 0) CreateQuad();
+
+        glm::mat4 M = glm::ortho(0.0f, (float)windowW, 0.0f, (float)windowH, -1.0f, 1.0f);
+        M = glm::scale(M, glm::vec3((float)width, (float)height, 1.0f));
+
+        program->Use();
+        program->Set(uMVP, M);
+        program->Set(uColor, glm::vec3(1.0f));
+        program->Set(uUseTexture, 1);
+        program->Set(uTex, 0);
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, tex);
+
+        glDisable(GL_DEPTH_TEST);
+        glBindVertexArray(quadVAO);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        glBindVertexArray(0);
+    }
+};
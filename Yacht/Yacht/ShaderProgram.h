@@ -0,0 +1,217 @@
+﻿#pragma once
+#include <gl/glew.h>
+#include <gl/glm/glm.hpp>
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstring>
+
+// =============================================================
+// Shader 컴파일 / 링크
+// =============================================================
+inline std::string LoadTextFile(const char* path)
+{
+    std::ifstream f(path);
+    if (!f.is_open()) {
+        std::cerr << "Failed to open shader : " << path << std::endl;
+        return "";
+    }
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return ss.str();
+}
+
+inline GLuint CompileShader(const char* path, GLenum type)
+{
+    std::string src = LoadTextFile(path);
+    const char* csrc = src.c_str();
+
+    GLuint sh = glCreateShader(type);
+    glShaderSource(sh, 1, &csrc, nullptr);
+    glCompileShader(sh);
+
+    GLint ok;
+    glGetShaderiv(sh, GL_COMPILE_STATUS, &ok);
+
+    if (!ok)
+    {
+        char log[2048];
+        glGetShaderInfoLog(sh, 2048, nullptr, log);
+        std::cerr << "Shader compile error: " << log << std::endl;
+    }
+    return sh;
+}
+
+inline GLuint CreateProgram(const char* vsPath, const char* fsPath)
+{
+    GLuint vs = CompileShader(vsPath, GL_VERTEX_SHADER);
+    GLuint fs = CompileShader(fsPath, GL_FRAGMENT_SHADER);
+
+    GLuint prg = glCreateProgram();
+    glAttachShader(prg, vs);
+    glAttachShader(prg, fs);
+    glLinkProgram(prg);
+
+    GLint ok;
+    glGetProgramiv(prg, GL_LINK_STATUS, &ok);
+    if (!ok)
+    {
+        char log[2048];
+        glGetProgramInfoLog(prg, 2048, nullptr, log);
+        std::cerr << "Program link error: " << log << std::endl;
+    }
+
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    return prg;
+}
+
+// =============================================================
+// ShaderProgram
+//  - 링크 직후 활성 uniform / attribute 를 한 번만 조회해 위치를 보관
+//    => 그리기 중에는 glGetUniformLocation 문자열 조회가 없다
+//  - uniform 마다 마지막으로 올린 값을 기억해 같은 값이면 건너뛴다
+//    (uniform 값은 프로그램마다 따로 유지되므로 프로그램 단위로 기억)
+//  - 현재 바인딩된 프로그램을 기억해 같은 glUseProgram 은 건너뛴다
+//    => 고정 파이프라인으로 돌아갈 때도 glUseProgram(0) 대신 UseNone()
+// =============================================================
+struct ShaderProgram
+{
+    struct Uniform
+    {
+        std::string name;      // 배열이면 "[0]" 을 뗀 이름
+        GLint       location;
+        GLenum      type;
+        GLint       size;
+        bool        known = false;
+        uint8_t     shadow[sizeof(float) * 16];   // 마지막으로 올린 값 (mat4 까지)
+    };
+
+    struct Attribute
+    {
+        std::string name;
+        GLint       location;
+        GLenum      type;
+        GLint       size;
+    };
+
+    GLuint id = 0;
+    std::vector<Uniform>   uniforms;
+    std::vector<Attribute> attributes;
+
+    static GLuint& Bound()
+    {
+        static GLuint bound = 0;
+        return bound;
+    }
+
+    bool Create(const char* vsPath, const char* fsPath)
+    {
+        id = CreateProgram(vsPath, fsPath);
+        GLint ok = 0;
+        glGetProgramiv(id, GL_LINK_STATUS, &ok);
+        if (!ok) return false;
+        Reflect();
+        return true;
+    }
+
+    void Reflect()
+    {
+        uniforms.clear();
+        attributes.clear();
+
+        char name[256];
+        GLint count = 0;
+        glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &count);
+        for (GLint i = 0; i < count; i++)
+        {
+            Uniform u;
+            GLsizei len = 0;
+            glGetActiveUniform(id, (GLuint)i, sizeof(name), &len, &u.size, &u.type, name);
+            u.location = glGetUniformLocation(id, name);
+            u.name.assign(name, len);
+            size_t br = u.name.find('[');
+            if (br != std::string::npos) u.name.resize(br);
+            uniforms.push_back(u);
+        }
+
+        glGetProgramiv(id, GL_ACTIVE_ATTRIBUTES, &count);
+        for (GLint i = 0; i < count; i++)
+        {
+            Attribute a;
+            GLsizei len = 0;
+            glGetActiveAttrib(id, (GLuint)i, sizeof(name), &len, &a.size, &a.type, name);
+            a.location = glGetAttribLocation(id, name);
+            a.name.assign(name, len);
+            attributes.push_back(a);
+        }
+    }
+
+    // uniform 번호 (없으면 -1). 자주 쓰는 곳은 한 번 찾아 두고 번호로 Set
+    int Find(const char* name) const
+    {
+        for (size_t i = 0; i < uniforms.size(); i++)
+            if (uniforms[i].name == name) return (int)i;
+        return -1;
+    }
+
+    GLint AttribLocation(const char* name) const
+    {
+        for (const Attribute& a : attributes)
+            if (a.name == name) return a.location;
+        return -1;
+    }
+
+    void Use() const
+    {
+        if (Bound() == id) return;
+        glUseProgram(id);
+        Bound() = id;
+    }
+
+    static void UseNone()
+    {
+        if (Bound() == 0) return;
+        glUseProgram(0);
+        Bound() = 0;
+    }
+
+    // 값이 바뀌었으면 true (shadow 갱신). 프로그램이 바인딩된 상태에서 호출
+    bool Changed(int u, const void* value, size_t bytes)
+    {
+        if (u < 0) return false;
+        Uniform& un = uniforms[u];
+        if (un.known && memcmp(un.shadow, value, bytes) == 0) return false;
+        memcpy(un.shadow, value, bytes);
+        un.known = true;
+        return true;
+    }
+
+    void Set(int u, int v)
+    {
+        if (Changed(u, &v, sizeof(v))) glUniform1i(uniforms[u].location, v);
+    }
+
+    void Set(int u, float v)
+    {
+        if (Changed(u, &v, sizeof(v))) glUniform1f(uniforms[u].location, v);
+    }
+
+    void Set(int u, const glm::vec2& v)
+    {
+        if (Changed(u, &v[0], sizeof(v))) glUniform2fv(uniforms[u].location, 1, &v[0]);
+    }
+
+    void Set(int u, const glm::vec3& v)
+    {
+        if (Changed(u, &v[0], sizeof(v))) glUniform3fv(uniforms[u].location, 1, &v[0]);
+    }
+
+    void Set(int u, const glm::mat4& m)
+    {
+        if (Changed(u, &m[0][0], sizeof(m))) glUniformMatrix4fv(uniforms[u].location, 1, GL_FALSE, &m[0][0]);
+    }
+};
@@ -0,0 +1,291 @@
+﻿#pragma once
+#include <gl/glew.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ShaderProgram.h"
+
+// =============================================================
+// 8x13 고정폭 글꼴 (X11 misc-fixed, GLUT_BITMAP_8_BY_13 과 같은 글리프)
+//  - 문자 ' ' ~ '~' 95개, 글자마다 14줄 (아래 줄부터), 최상위 비트 = 왼쪽 픽셀
+//  - 기준선은 아래에서 3줄 위
+// =============================================================
+constexpr int FONT_FIRST = 32;
+constexpr int FONT_COUNT = 95;
+constexpr int FONT_W = 8;          // 글자 폭 = 다음 글자까지 거리
+constexpr int FONT_H = 14;
+constexpr int FONT_BASELINE = 3;
+
+static const uint8_t FONT_8X13[FONT_COUNT][FONT_H] = {
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },   // space
+    {0x00,0x00,0x00,0x10,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x00 },   // !
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x00,0x00 },   // "
+    {0x00,0x00,0x00,0x00,0x24,0x24,0x7e,0x24,0x7e,0x24,0x24,0x00,0x00,0x00 },   // #
+    {0x00,0x00,0x00,0x10,0x78,0x14,0x14,0x38,0x50,0x50,0x3c,0x10,0x00,0x00 },   // $
+    {0x00,0x00,0x00,0x44,0x2a,0x24,0x10,0x08,0x08,0x24,0x52,0x22,0x00,0x00 },   // %
+    {0x00,0x00,0x00,0x3a,0x44,0x4a,0x30,0x48,0x48,0x30,0x00,0x00,0x00,0x00 },   // &
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x30,0x38,0x00,0x00 },   // '
+    {0x00,0x00,0x00,0x04,0x08,0x08,0x10,0x10,0x10,0x08,0x08,0x04,0x00,0x00 },   // (
+    {0x00,0x00,0x00,0x20,0x10,0x10,0x08,0x08,0x08,0x10,0x10,0x20,0x00,0x00 },   // )
+    {0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x7e,0x18,0x24,0x00,0x00,0x00,0x00 },   // *
+    {0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x7c,0x10,0x10,0x00,0x00,0x00,0x00 },   // +
+    {0x00,0x00,0x40,0x30,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },   // ,
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00 },   // -
+    {0x00,0x00,0x10,0x38,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },   // .
+    {0x00,0x00,0x00,0x80,0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x02,0x00,0x00 },   // /
+    {0x00,0x00,0x00,0x18,0x24,0x42,0x42,0x42,0x42,0x42,0x24,0x18,0x00,0x00 },   // 0
+    {0x00,0x00,0x00,0x7c,0x10,0x10,0x10,0x10,0x10,0x50,0x30,0x10,0x00,0x00 },   // 1
+    {0x00,0x00,0x00,0x7e,0x40,0x20,0x18,0x04,0x02,0x42,0x42,0x3c,0x00,0x00 },   // 2
+    {0x00,0x00,0x00,0x3c,0x42,0x02,0x02,0x1c,0x08,0x04,0x02,0x7e,0x00,0x00 },   // 3
+    {0x00,0x00,0x00,0x04,0x04,0x7e,0x44,0x44,0x24,0x14,0x0c,0x04,0x00,0x00 },   // 4
+    {0x00,0x00,0x00,0x3c,0x42,0x02,0x02,0x62,0x5c,0x40,0x40,0x7e,0x00,0x00 },   // 5
+    {0x00,0x00,0x00,0x3c,0x42,0x42,0x62,0x5c,0x40,0x40,0x20,0x1c,0x00,0x00 },   // 6
+    {0x00,0x00,0x00,0x20,0x20,0x10,0x10,0x08,0x08,0x04,0x02,0x7e,0x00,0x00 },   // 7
+    {0x00,0x00,0x00,0x3c,0x42,0x42,0x42,0x3c,0x42,0x42,0x42,0x3c,0x00,0x00 },   // 8
+    {0x00,0x00,0x00,0x38,0x04,0x02,0x02,0x3a,0x46,0x42,0x42,0x3c,0x00,0x00 },   // 9
+    {0x00,0x00,0x10,0x38,0x10,0x00,0x00,0x10,0x38,0x10,0x00,0x00,0x00,0x00 },   // :
+    {0x00,0x00,0x40,0x30,0x38,0x00,0x00,0x10,0x38,0x10,0x00,0x00,0x00,0x00 },   // ;
+    {0x00,0x00,0x00,0x02,0x04,0x08,0x10,0x20,0x10,0x08,0x04,0x02,0x00,0x00 },   // <
+    {0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00 },   // =
+    {0x00,0x00,0x00,0x40,0x20,0x10,0x08,0x04,0x08,0x10,0x20,0x40,0x00,0x00 },   // >
+    {0x00,0x00,0x00,0x08,0x00,0x08,0x08,0x04,0x02,0x42,0x42,0x3c,0x00,0x00 },   // ?
+    {0x00,0x00,0x00,0x3c,0x40,0x4a,0x56,0x52,0x4e,0x42,0x42,0x3c,0x00,0x00 },   // @
+    {0x00,0x00,0x00,0x42,0x42,0x42,0x7e,0x42,0x42,0x42,0x24,0x18,0x00,0x00 },   // A
+    {0x00,0x00,0x00,0xfc,0x42,0x42,0x42,0x7c,0x42,0x42,0x42,0xfc,0x00,0x00 },   // B
+    {0x00,0x00,0x00,0x3c,0x42,0x40,0x40,0x40,0x40,0x40,0x42,0x3c,0x00,0x00 },   // C
+    {0x00,0x00,0x00,0xfc,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0xfc,0x00,0x00 },   // D
+    {0x00,0x00,0x00,0x7e,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7e,0x00,0x00 },   // E
+    {0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7e,0x00,0x00 },   // F
+    {0x00,0x00,0x00,0x3a,0x46,0x42,0x4e,0x40,0x40,0x40,0x42,0x3c,0x00,0x00 },   // G
+    {0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x7e,0x42,0x42,0x42,0x42,0x00,0x00 },   // H
+    {0x00,0x00,0x00,0x7c,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x7c,0x00,0x00 },   // I
+    {0x00,0x00,0x00,0x38,0x44,0x04,0x04,0x04,0x04,0x04,0x04,0x1f,0x00,0x00 },   // J
+    {0x00,0x00,0x00,0x42,0x44,0x48,0x50,0x60,0x50,0x48,0x44,0x42,0x00,0x00 },   // K
+    {0x00,0x00,0x00,0x7e,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x00,0x00 },   // L
+    {0x00,0x00,0x00,0x82,0x82,0x82,0x92,0x92,0xaa,0xc6,0x82,0x82,0x00,0x00 },   // M
+    {0x00,0x00,0x00,0x42,0x42,0x42,0x46,0x4a,0x52,0x62,0x42,0x42,0x00,0x00 },   // N
+    {0x00,0x00,0x00,0x3c,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3c,0x00,0x00 },   // O
+    {0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x7c,0x42,0x42,0x42,0x7c,0x00,0x00 },   // P
+    {0x00,0x00,0x02,0x3c,0x4a,0x52,0x42,0x42,0x42,0x42,0x42,0x3c,0x00,0x00 },   // Q
+    {0x00,0x00,0x00,0x42,0x44,0x48,0x50,0x7c,0x42,0x42,0x42,0x7c,0x00,0x00 },   // R
+    {0x00,0x00,0x00,0x3c,0x42,0x02,0x02,0x3c,0x40,0x40,0x42,0x3c,0x00,0x00 },   // S
+    {0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xfe,0x00,0x00 },   // T
+    {0x00,0x00,0x00,0x3c,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x00,0x00 },   // U
+    {0x00,0x00,0x00,0x10,0x28,0x28,0x28,0x44,0x44,0x44,0x82,0x82,0x00,0x00 },   // V
+    {0x00,0x00,0x00,0x44,0xaa,0x92,0x92,0x92,0x82,0x82,0x82,0x82,0x00,0x00 },   // W
+    {0x00,0x00,0x00,0x82,0x82,0x44,0x28,0x10,0x28,0x44,0x82,0x82,0x00,0x00 },   // X
+    {0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x28,0x44,0x82,0x82,0x00,0x00 },   // Y
+    {0x00,0x00,0x00,0x7e,0x40,0x40,0x20,0x10,0x08,0x04,0x02,0x7e,0x00,0x00 },   // Z
+    {0x00,0x00,0x00,0x3c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x00,0x00 },   // [
+    {0x00,0x00,0x00,0x02,0x02,0x04,0x08,0x10,0x20,0x40,0x80,0x80,0x00,0x00 },   // backslash
+    {0x00,0x00,0x00,0x78,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x78,0x00,0x00 },   // ]
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x28,0x10,0x00,0x00 },   // ^
+    {0x00,0x00,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },   // _
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x18,0x38,0x00,0x00 },   // `
+    {0x00,0x00,0x00,0x3a,0x46,0x42,0x3e,0x02,0x3c,0x00,0x00,0x00,0x00,0x00 },   // a
+    {0x00,0x00,0x00,0x5c,0x62,0x42,0x42,0x62,0x5c,0x40,0x40,0x40,0x00,0x00 },   // b
+    {0x00,0x00,0x00,0x3c,0x42,0x40,0x40,0x42,0x3c,0x00,0x00,0x00,0x00,0x00 },   // c
+    {0x00,0x00,0x00,0x3a,0x46,0x42,0x42,0x46,0x3a,0x02,0x02,0x02,0x00,0x00 },   // d
+    {0x00,0x00,0x00,0x3c,0x42,0x40,0x7e,0x42,0x3c,0x00,0x00,0x00,0x00,0x00 },   // e
+    {0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x7c,0x20,0x20,0x22,0x1c,0x00,0x00 },   // f
+    {0x00,0x3c,0x42,0x3c,0x40,0x38,0x44,0x44,0x3a,0x00,0x00,0x00,0x00,0x00 },   // g
+    {0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x62,0x5c,0x40,0x40,0x40,0x00,0x00 },   // h
+    {0x00,0x00,0x00,0x7c,0x10,0x10,0x10,0x10,0x30,0x00,0x10,0x00,0x00,0x00 },   // i
+    {0x00,0x38,0x44,0x44,0x04,0x04,0x04,0x04,0x0c,0x00,0x04,0x00,0x00,0x00 },   // j
+    {0x00,0x00,0x00,0x42,0x44,0x48,0x70,0x48,0x44,0x40,0x40,0x40,0x00,0x00 },   // k
+    {0x00,0x00,0x00,0x7c,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x30,0x00,0x00 },   // l
+    {0x00,0x00,0x00,0x82,0x92,0x92,0x92,0x92,0xec,0x00,0x00,0x00,0x00,0x00 },   // m
+    {0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x62,0x5c,0x00,0x00,0x00,0x00,0x00 },   // n
+    {0x00,0x00,0x00,0x3c,0x42,0x42,0x42,0x42,0x3c,0x00,0x00,0x00,0x00,0x00 },   // o
+    {0x00,0x40,0x40,0x40,0x5c,0x62,0x42,0x62,0x5c,0x00,0x00,0x00,0x00,0x00 },   // p
+    {0x00,0x02,0x02,0x02,0x3a,0x46,0x42,0x46,0x3a,0x00,0x00,0x00,0x00,0x00 },   // q
+    {0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x22,0x5c,0x00,0x00,0x00,0x00,0x00 },   // r
+    {0x00,0x00,0x00,0x3c,0x42,0x0c,0x30,0x42,0x3c,0x00,0x00,0x00,0x00,0x00 },   // s
+    {0x00,0x00,0x00,0x1c,0x22,0x20,0x20,0x20,0x7c,0x20,0x20,0x00,0x00,0x00 },   // t
+    {0x00,0x00,0x00,0x3a,0x44,0x44,0x44,0x44,0x44,0x00,0x00,0x00,0x00,0x00 },   // u
+    {0x00,0x00,0x00,0x10,0x28,0x28,0x44,0x44,0x44,0x00,0x00,0x00,0x00,0x00 },   // v
+    {0x00,0x00,0x00,0x44,0xaa,0x92,0x92,0x82,0x82,0x00,0x00,0x00,0x00,0x00 },   // w
+    {0x00,0x00,0x00,0x42,0x24,0x18,0x18,0x24,0x42,0x00,0x00,0x00,0x00,0x00 },   // x
+    {0x00,0x3c,0x42,0x02,0x3a,0x46,0x42,0x42,0x42,0x00,0x00,0x00,0x00,0x00 },   // y
+    {0x00,0x00,0x00,0x7e,0x20,0x10,0x08,0x04,0x7e,0x00,0x00,0x00,0x00,0x00 },   // z
+    {0x00,0x00,0x00,0x0e,0x10,0x10,0x08,0x30,0x08,0x10,0x10,0x0e,0x00,0x00 },   // {
+    {0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x00 },   // |
+    {0x00,0x00,0x00,0x70,0x08,0x08,0x10,0x0c,0x10,0x08,0x08,0x70,0x00,0x00 },   // }
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x54,0x24,0x00,0x00 },   // ~
+};
+
+// =============================================================
+// 글리프 아틀라스 텍스트 렌더러
+//  - 시작할 때 글꼴을 텍스처 하나(16 x 6 칸, GL_R8)에 한 번만 굽는다
+//  - Text() / Rect() 는 정점 배열에 사각형을 쌓기만 하고,
+//    Flush() 가 프레임의 글자 전부를 draw call 한 번으로 그린다
+//    (glutBitmapCharacter 는 글자마다 래스터 위치 경로를 탄다)
+//  - 좌표는 창 픽셀 (왼쪽 아래 0,0), 글자는 픽셀 격자에 맞춰 찍는다
+// =============================================================
+constexpr int ATLAS_COLS = 16;
+constexpr int ATLAS_ROWS = 6;
+constexpr int ATLAS_W = ATLAS_COLS * FONT_W;
+constexpr int ATLAS_H = ATLAS_ROWS * FONT_H;
+constexpr int ATLAS_SOLID = FONT_COUNT;      // 마지막 칸은 꽉 찬 칸 (Rect 용)
+
+struct TextVertex
+{
+    float   x, y;
+    float   u, v;
+    uint8_t rgba[4];
+};
+
+struct TextColor
+{
+    uint8_t r, g, b, a;
+
+    TextColor(float r_ = 0.0f, float g_ = 0.0f, float b_ = 0.0f, float a_ = 1.0f)
+        : r((uint8_t)(r_ * 255.0f + 0.5f)), g((uint8_t)(g_ * 255.0f + 0.5f)),
+          b((uint8_t)(b_ * 255.0f + 0.5f)), a((uint8_t)(a_ * 255.0f + 0.5f)) {}
+};
+
+struct TextRenderer
+{
+    ShaderProgram program;
+    GLuint atlas = 0;
+    GLuint vao = 0, vbo = 0, ebo = 0;
+    GLsizei quadCapacity = 0;              // vbo / ebo 에 들어가는 사각형 수
+
+    std::vector<TextVertex> verts;         // 이번 프레임에 쌓인 사각형 (4개씩)
+
+    int uScreen = -1, uAtlas = -1;
+
+    bool Init(const char* vsPath, const char* fsPath)
+    {
+        if (!program.Create(vsPath, fsPath)) return false;
+        uScreen = program.Find("uScreen");
+        uAtlas = program.Find("uAtlas");
+
+        // 아틀라스 굽기: 비트 -> 0 / 255
+        std::vector<uint8_t> px(ATLAS_W * ATLAS_H, 0);
+        for (int i = 0; i <= FONT_COUNT; i++)
+        {
+            int cx = (i % ATLAS_COLS) * FONT_W, cy = (i / ATLAS_COLS) * FONT_H;
+            for (int row = 0; row < FONT_H; row++)
+            {
+                uint8_t bits = i == ATLAS_SOLID ? 0xFF : FONT_8X13[i][row];
+                for (int b = 0; b < FONT_W; b++)
+                    px[(cy + row) * ATLAS_W + cx + b] = (bits & (0x80 >> b)) ? 255 : 0;
+            }
+        }
+
+        glGenTextures(1, &atlas);
+        glBindTexture(GL_TEXTURE_2D, atlas);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, ATLAS_W, ATLAS_H, 0, GL_RED, GL_UNSIGNED_BYTE, px.data());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        glGenVertexArrays(1, &vao);
+        glGenBuffers(1, &vbo);
+        glGenBuffers(1, &ebo);
+
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (void*)offsetof(TextVertex, x));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (void*)offsetof(TextVertex, u));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(TextVertex), (void*)offsetof(TextVertex, rgba));
+        glBindVertexArray(0);
+        return true;
+    }
+
+    // (x0, y0) ~ (x1, y1) 픽셀 사각형에 아틀라스의 (s0, t0) ~ (s1, t1) 텍셀 (텍셀 단위)
+    void Quad(float x0, float y0, float x1, float y1,
+        float s0, float t0, float s1, float t1, const TextColor& c)
+    {
+        const float iu = 1.0f / ATLAS_W, iv = 1.0f / ATLAS_H;
+        TextVertex q[4] = {
+            { x0, y0, s0 * iu, t0 * iv, { c.r, c.g, c.b, c.a } },
+            { x1, y0, s1 * iu, t0 * iv, { c.r, c.g, c.b, c.a } },
+            { x1, y1, s1 * iu, t1 * iv, { c.r, c.g, c.b, c.a } },
+            { x0, y1, s0 * iu, t1 * iv, { c.r, c.g, c.b, c.a } },
+        };
+        verts.insert(verts.end(), q, q + 4);
+    }
+
+    // (x, y) = 첫 글자의 기준선 왼쪽 (glRasterPos 와 같은 기준)
+    void Text(float x, float y, const char* s, const TextColor& c = TextColor())
+    {
+        float x0 = std::floor(x);
+        float y0 = std::floor(y) - FONT_BASELINE;
+        for (; *s; s++, x0 += FONT_W)
+        {
+            int i = (unsigned char)*s - FONT_FIRST;
+            if (i <= 0 || i >= FONT_COUNT) continue;     // 공백 / 글꼴에 없는 문자
+
+            float s0 = (float)((i % ATLAS_COLS) * FONT_W);
+            float t0 = (float)((i / ATLAS_COLS) * FONT_H);
+            Quad(x0, y0, x0 + FONT_W, y0 + FONT_H, s0, t0, s0 + FONT_W, t0 + FONT_H, c);
+        }
+    }
+
+    // 단색 사각형 (꽉 찬 칸의 가운데 텍셀만 쓴다)
+    void Rect(float x0, float y0, float x1, float y1, const TextColor& c)
+    {
+        float s = (ATLAS_SOLID % ATLAS_COLS) * FONT_W + FONT_W * 0.5f;
+        float t = (ATLAS_SOLID / ATLAS_COLS) * FONT_H + FONT_H * 0.5f;
+        Quad(x0, y0, x1, y1, s, t, s, t, c);
+    }
+
+    // 쌓인 사각형을 창 전체 (width x height) 에 한 번에 그리고 비운다. 뷰포트는 호출하는 쪽에서
+    void Flush(int width, int height)
+    {
+        GLsizei quads = (GLsizei)(verts.size() / 4);
+        if (quads == 0) return;
+
+        glBindVertexArray(vao);
+
+        // 인덱스는 사각형 수가 늘 때만 다시 만든다 (0 1 2, 0 2 3 반복)
+        if (quads > quadCapacity)
+        {
+            quadCapacity = std::max(quads, quadCapacity * 2);
+            std::vector<uint32_t> idx(quadCapacity * 6);
+            for (GLsizei q = 0; q < quadCapacity; q++)
+            {
+                uint32_t b = (uint32_t)q * 4;
+                uint32_t* o = &idx[q * 6];
+                o[0] = b; o[1] = b + 1; o[2] = b + 2;
+                o[3] = b; o[4] = b + 2; o[5] = b + 3;
+            }
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx.size() * sizeof(uint32_t), idx.data(), GL_STATIC_DRAW);
+        }
+
+        // 정점은 매 프레임 새 버퍼를 받아(orphan) 이전 프레임과 겹치지 않게
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(TextVertex) * 4 * quadCapacity, nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(TextVertex) * verts.size(), verts.data());
+
+        program.Use();
+        program.Set(uScreen, glm::vec2((float)width, (float)height));
+        program.Set(uAtlas, 0);
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, atlas);
+
+        glDisable(GL_DEPTH_TEST);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        glDrawElements(GL_TRIANGLES, quads * 6, GL_UNSIGNED_INT, nullptr);
+
+        glDisable(GL_BLEND);
+        glBindVertexArray(0);
+        verts.clear();
+    }
+};
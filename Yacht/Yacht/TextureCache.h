@@ -0,0 +1,272 @@
+﻿#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "stb_image.h"
+#include "../../Common/YachtMappedFile.h"
+
+// =============================================================
+// 밉맵 텍스처 캐시 (<png>.ytex)
+//  - 처음 PNG 를 읽을 때 밉맵 전체를 CPU 에서 만들어 저장하고,
+//    다음 실행부터는 매핑만 하면 바로 단계별 glTexImage2D 가능
+//    (PNG 디코딩 / glGenerateMipmap 없음)
+//  - 원본 확인 방식은 메시 캐시와 같다 (크기 + 시각, 다르면 해시)
+//  - 헤더와 픽셀 데이터에 FNV-1a 체크섬 (깨진 캐시는 다시 만든다)
+//
+//  [헤더][0단계][1단계]...  (모두 RGBA8, 아래 행부터 = GL 순서)
+// =============================================================
+constexpr uint32_t TEXTURE_FILE_VERSION = 3;     // 2: 홀수 크기 밉맵 3탭 필터, 3: 데이터 체크섬
+constexpr size_t   TEXTURE_ALIGN = 64;
+constexpr int      TEXTURE_MAX_LEVELS = 16;
+
+enum TextureFormat : uint32_t
+{
+    TEXTURE_RGBA8 = 1,
+};
+
+struct TextureLevel
+{
+    uint32_t width, height;
+    uint64_t offset;     // 데이터 시작 기준
+    uint64_t size;
+};
+
+struct TextureFileHeader
+{
+    char         magic[4];          // "YTEX"
+    uint32_t     version;
+    uint32_t     headerSize;
+    uint32_t     format;            // TextureFormat
+    uint32_t     levelCount;
+    uint32_t     reserved;
+    TextureLevel levels[TEXTURE_MAX_LEVELS];
+    uint64_t     sourceSize;
+    int64_t      sourceTime;
+    uint64_t     sourceHash;
+    uint64_t     dataOffset, dataSize;
+    uint64_t     dataChecksum;
+    uint64_t     headerChecksum;    // 이 필드를 0 으로 두고 계산
+};
+
+// 메모리에 있는 밉맵 묶음 (매핑된 캐시이든 방금 만든 것이든)
+struct TextureView
+{
+    const uint8_t* data = nullptr;
+    uint64_t       dataSize = 0;
+    uint32_t       format = TEXTURE_RGBA8;
+    uint32_t       levelCount = 0;
+    TextureLevel   levels[TEXTURE_MAX_LEVELS] = {};
+};
+
+inline std::string TextureCachePath(const char* imagePath)
+{
+    return std::string(imagePath) + ".ytex";
+}
+
+inline uint64_t TextureHeaderChecksum(TextureFileHeader hdr)
+{
+    hdr.headerChecksum = 0;
+    return Fnv1a64(&hdr, sizeof(hdr));
+}
+
+// 밉맵 한 단계에서 한 축의 필터 (원본 픽셀 최대 3개 + 가중치)
+//  - 짝수: 2i, 2i+1 을 반씩
+//  - 홀수 (n = 2m + 1): 2i, 2i+1, 2i+2 를 (m - i, m, i + 1) / n 으로
+//    => 대상 픽셀이 덮는 원본 구간 [i n/m, (i+1) n/m] 그대로, 마지막 행 / 열도 빠지지 않는다
+//  - 1: 그대로
+struct MipTap
+{
+    uint32_t src[3];
+    float    weight[3];
+};
+
+inline void BuildMipTaps(uint32_t n, uint32_t m, std::vector<MipTap>& taps)
+{
+    taps.resize(m);
+    for (uint32_t i = 0; i < m; i++)
+    {
+        MipTap& t = taps[i];
+        if (n == 1)
+            t = { { 0, 0, 0 }, { 1.0f, 0.0f, 0.0f } };
+        else if (n % 2 == 0)
+            t = { { 2 * i, 2 * i + 1, 2 * i + 1 }, { 0.5f, 0.5f, 0.0f } };
+        else
+            t = { { 2 * i, 2 * i + 1, 2 * i + 2 },
+                  { (float)(m - i) / n, (float)m / n, (float)(i + 1) / n } };
+    }
+}
+
+// RGBA8 원본 -> 1x1 까지 밉맵 (짝수 크기는 2x2 평균, 홀수 크기는 3탭)
+inline void BuildMipChain(const uint8_t* rgba, uint32_t width, uint32_t height,
+    std::vector<uint8_t>& chain, TextureView& view)
+{
+    view = TextureView();
+    view.format = TEXTURE_RGBA8;
+
+    uint64_t total = 0;
+    uint32_t w = width, h = height;
+    while (view.levelCount < TEXTURE_MAX_LEVELS)
+    {
+        TextureLevel& lv = view.levels[view.levelCount++];
+        lv.width = w;
+        lv.height = h;
+        lv.offset = total;
+        lv.size = (uint64_t)w * h * 4;
+        total += lv.size;
+        if (w == 1 && h == 1) break;
+        w = w > 1 ? w / 2 : 1;
+        h = h > 1 ? h / 2 : 1;
+    }
+
+    chain.resize(total);
+    memcpy(chain.data(), rgba, view.levels[0].size);
+
+    std::vector<MipTap> xTaps, yTaps;
+    for (uint32_t l = 1; l < view.levelCount; l++)
+    {
+        const TextureLevel& s = view.levels[l - 1];
+        const TextureLevel& d = view.levels[l];
+        const uint8_t* src = chain.data() + s.offset;
+        uint8_t* dst = chain.data() + d.offset;
+        BuildMipTaps(s.width, d.width, xTaps);
+        BuildMipTaps(s.height, d.height, yTaps);
+
+        for (uint32_t y = 0; y < d.height; y++)
+        {
+            const MipTap& ty = yTaps[y];
+            for (uint32_t x = 0; x < d.width; x++)
+            {
+                const MipTap& tx = xTaps[x];
+                float sum[4] = {};
+                for (int j = 0; j < 3; j++)
+                {
+                    if (ty.weight[j] == 0.0f) continue;
+                    const uint8_t* row = src + (size_t)ty.src[j] * s.width * 4;
+                    for (int i = 0; i < 3; i++)
+                    {
+                        float w = ty.weight[j] * tx.weight[i];
+                        if (w == 0.0f) continue;
+                        const uint8_t* p = row + (size_t)tx.src[i] * 4;
+                        for (int c = 0; c < 4; c++) sum[c] += w * p[c];
+                    }
+                }
+                uint8_t* o = dst + ((size_t)y * d.width + x) * 4;
+                for (int c = 0; c < 4; c++)
+                    o[c] = (uint8_t)std::min(255.0f, sum[c] + 0.5f);
+            }
+        }
+    }
+
+    view.data = chain.data();
+    view.dataSize = total;
+}
+
+inline bool SaveTextureCache(const char* cachePath, const char* imagePath, const TextureView& view)
+{
+    TextureFileHeader hdr = {};
+    hdr.magic[0] = 'Y'; hdr.magic[1] = 'T'; hdr.magic[2] = 'E'; hdr.magic[3] = 'X';
+    hdr.version = TEXTURE_FILE_VERSION;
+    hdr.headerSize = sizeof(hdr);
+    hdr.format = view.format;
+    hdr.levelCount = view.levelCount;
+    memcpy(hdr.levels, view.levels, sizeof(hdr.levels));
+    if (!SourceStamp(imagePath, hdr.sourceSize, hdr.sourceTime)) return false;
+    hdr.sourceHash = SourceHash(imagePath);
+    hdr.dataOffset = AlignUp(sizeof(hdr), TEXTURE_ALIGN);
+    hdr.dataSize = view.dataSize;
+    hdr.dataChecksum = Fnv1a64(view.data, view.dataSize);
+    hdr.headerChecksum = TextureHeaderChecksum(hdr);
+
+    std::string tmp = TempPathFor(cachePath);
+    std::ofstream f(tmp, std::ios::binary);
+    if (!f.is_open()) return false;
+
+    static const char pad[TEXTURE_ALIGN] = {};
+    f.write((const char*)&hdr, sizeof(hdr));
+    f.write(pad, hdr.dataOffset - sizeof(hdr));
+    f.write((const char*)view.data, view.dataSize);
+    return CommitTempFile(f, tmp, cachePath);
+}
+
+// 매핑된 텍스처 캐시 (내용은 view 로)
+struct MappedTexture
+{
+    MappedFile  file;
+    TextureView view;
+
+    // imagePath 가 있으면 원본과 맞는지 확인 (nullptr 이면 확인 안 함)
+    bool Open(const char* cachePath, const char* imagePath)
+    {
+        view = TextureView();
+        if (!file.Open(cachePath)) return false;
+
+        TextureFileHeader hdr;
+        if (file.size < sizeof(hdr)) return Fail();
+        memcpy(&hdr, file.data, sizeof(hdr));
+
+        if (hdr.magic[0] != 'Y' || hdr.magic[1] != 'T' || hdr.magic[2] != 'E' || hdr.magic[3] != 'X'
+            || hdr.version != TEXTURE_FILE_VERSION || hdr.headerSize != sizeof(hdr)
+            || hdr.headerChecksum != TextureHeaderChecksum(hdr))
+            return Fail();
+
+        if (hdr.format != TEXTURE_RGBA8 || hdr.levelCount == 0 || hdr.levelCount > TEXTURE_MAX_LEVELS
+            || hdr.dataOffset % TEXTURE_ALIGN || hdr.dataOffset + hdr.dataSize > file.size)
+            return Fail();
+        for (uint32_t l = 0; l < hdr.levelCount; l++)
+        {
+            const TextureLevel& lv = hdr.levels[l];
+            if (lv.size != (uint64_t)lv.width * lv.height * 4 || lv.offset + lv.size > hdr.dataSize)
+                return Fail();
+        }
+        if (Fnv1a64(file.data + hdr.dataOffset, hdr.dataSize) != hdr.dataChecksum) return Fail();
+
+        bool restamp;
+        if (!SourceMatches(imagePath, hdr.sourceSize, hdr.sourceTime, hdr.sourceHash, restamp))
+            return Fail();
+        if (restamp)
+        {
+            hdr.headerChecksum = TextureHeaderChecksum(hdr);
+            RewriteHeader(cachePath, hdr);
+        }
+
+        view.data = file.data + hdr.dataOffset;
+        view.dataSize = hdr.dataSize;
+        view.format = hdr.format;
+        view.levelCount = hdr.levelCount;
+        memcpy(view.levels, hdr.levels, sizeof(view.levels));
+        return true;
+    }
+
+    bool Fail()
+    {
+        file.Close();
+        return false;
+    }
+};
+
+// PNG 를 디코딩해 밉맵을 만든다 (stb_image, 아래 행부터)
+inline bool DecodeMipChain(const char* imagePath, std::vector<uint8_t>& chain, TextureView& view)
+{
+    stbi_set_flip_vertically_on_load_thread(1);
+    int w, h, c;
+    unsigned char* px = stbi_load(imagePath, &w, &h, &c, 4);
+    if (!px) return false;
+
+    BuildMipChain(px, (uint32_t)w, (uint32_t)h, chain, view);
+    stbi_image_free(px);
+    return true;
+}
+
+// 오프라인 굽기 / 첫 실행
+inline bool BakeTexture(const char* imagePath)
+{
+    std::vector<uint8_t> chain;
+    TextureView view;
+    if (!DecodeMipChain(imagePath, chain, view)) return false;
+    return SaveTextureCache(TextureCachePath(imagePath).c_str(), imagePath, view);
+}
@@ -7,18 +7,33 @@
 #include <gl/glm/gtc/matrix_transform.hpp>
 
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <vector>
 #include <random>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <string>
+#include <chrono>
+#include <filesystem>
 
 // =============================================================
 // stb_image.h (텍스처 로드)
 // =============================================================
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
+#undef STB_IMAGE_IMPLEMENTATION    // 구현은 여기서 한 번만 (AssetLoader.h 가 다시 포함)
+
+#include "ShaderProgram.h"
+#include "AssetLoader.h"
+#include "TextRenderer.h"
+#include "FrameClock.h"
+#include "Headless.h"
+#include "FrameProfiler.h"
+#include "PanelCache.h"
+
+#include "../../Common/YachtRng.h"
+#include "../../Common/YachtGame.h"
+#include "../../Common/YachtSolver.h"
 
 using glm::vec3;
 using glm::mat4;
@@ -29,7 +44,27 @@ using glm::mat4;
 int gWidth = 1280;
 int gHeight = 720;
 
-GLuint gProgram = 0;
+ShaderProgram gProgram;
+ShaderProgram gInstProgram;  // 주사위 인스턴스 그리기용
+
+// 두 프로그램이 쓰는 uniform 번호 (InitGL 에서 한 번 찾아 두고 그릴 때는 번호로 Set)
+struct SceneUniforms
+{
+    int mvp = -1, viewProj = -1, color = -1, useTexture = -1, tex = -1;
+
+    void Find(const ShaderProgram& prog)
+    {
+        mvp = prog.Find("uMVP");
+        viewProj = prog.Find("uViewProj");
+        color = prog.Find("uColor");
+        useTexture = prog.Find("uUseTexture");
+        tex = prog.Find("uTex");
+    }
+};
+SceneUniforms gProgramU, gInstProgramU;
+TextRenderer  gText;         // 글자 / 점수판 배경 (프레임 끝에 한 번에 그린다)
+FrameProfiler gProfiler;     // 단계별 시간 (--bench 일 때만 켜짐)
+PanelCache    gPanel;        // 점수판 텍스처 (내용이 바뀔 때만 다시 그린다)
 GLuint gCubeVAO = 0, gCubeVBO = 0;
 
 GLuint gDiceTex = 0;
@@ -41,213 +76,120 @@ vec3 camTarget = vec3(0.0f, 4.6f, 0.0f);
 vec3 camUp = vec3(0.0f, 0.0f, -1.0f);
 
 // 랜덤
-std::mt19937 rng{ std::random_device{}() };
-std::uniform_int_distribution<int>   distVal(1, 6);
+uint64_t gSeed = ((uint64_t)std::random_device{}() << 32) | std::random_device{}();   // --seed 로 고정 가능
+Xoshiro256pp rng{ gSeed };
 std::uniform_real_distribution<float>distF(-0.5f, 0.5f);
 
-// =============================================================
-// Shader
-// =============================================================
-std::string LoadTextFile(const char* path)
-{
-    std::ifstream f(path);
-    if (!f.is_open()) {
-        std::cerr << "Failed to open shader : " << path << std::endl;
-        return "";
-    }
-    std::stringstream ss;
-    ss << f.rdbuf();
-    return ss.str();
-}
-
-GLuint CompileShader(const char* path, GLenum type)
-{
-    std::string src = LoadTextFile(path);
-    const char* csrc = src.c_str();
-
-    GLuint sh = glCreateShader(type);
-    glShaderSource(sh, 1, &csrc, nullptr);
-    glCompileShader(sh);
-
-    GLint ok;
-    glGetShaderiv(sh, GL_COMPILE_STATUS, &ok);
-
-    if (!ok)
-    {
-        char log[2048];
-        glGetShaderInfoLog(sh, 2048, nullptr, log);
-        std::cerr << "Shader compile error: " << log << std::endl;
-    }
-    return sh;
-}
-
-GLuint CreateProgram()
-{
-    GLuint vs = CompileShader("vertex.glsl", GL_VERTEX_SHADER);
-    GLuint fs = CompileShader("fragment.glsl", GL_FRAGMENT_SHADER);
-
-    GLuint prg = glCreateProgram();
-    glAttachShader(prg, vs);
-    glAttachShader(prg, fs);
-    glLinkProgram(prg);
-
-    GLint ok;
-    glGetProgramiv(prg, GL_LINK_STATUS, &ok);
-    if (!ok)
-    {
-        char log[2048];
-        glGetProgramInfoLog(prg, 2048, nullptr, log);
-        std::cerr << "Program link error: " << log << std::endl;
-    }
-
-    glDeleteShader(vs);
-    glDeleteShader(fs);
-    return prg;
-}
-
-// =============================================================
-// OBJ Loader
-// =============================================================
-bool LoadObj(const char* path, std::vector<float>& out)
+struct Model
 {
-    std::ifstream f(path);
-    if (!f.is_open()) {
-        std::cerr << "Failed to open OBJ: " << path << std::endl;
-        return false;
-    }
-
-    std::vector<glm::vec3> pos;
-    std::vector<glm::vec2> uv;
-
-    std::string line;
-
-    auto pushVert = [&](int vi, int ti) {
-        glm::vec3 p = pos[vi];
-        glm::vec2 t(0, 0);
-        if (ti >= 0 && ti < (int)uv.size())
-            t = uv[ti];
+    GLuint vao = 0, vbo = 0, ebo = 0;
+    GLsizei count = 0;                    // 인덱스 수
+    GLenum  indexType = GL_UNSIGNED_INT;  // 캐시에서 읽으면 정점 65536개 미만일 때 16비트
 
-        out.push_back(p.x);
-        out.push_back(p.y);
-        out.push_back(p.z);
-        out.push_back(t.x);
-        out.push_back(t.y);
-        };
+    GLuint instVBO = 0;          // 인스턴스별 모델 행렬 (attribute 2~5)
+    GLsizei instCapacity = 0;
 
-    while (std::getline(f, line))
+    // 메시 올리기 (이미 있으면 교체: 자리 표시 -> 실제 에셋)
+    void upload(const MeshView& mesh)
     {
-        if (line.size() < 2 || line[0] == '#') continue;
-
-        std::istringstream iss(line);
-        std::string tag;
-        iss >> tag;
-
-        if (tag == "v")
-        {
-            float x, y, z;
-            iss >> x >> y >> z;
-            pos.push_back({ x,y,z });
-        }
-        else if (tag == "vt")
-        {
-            float u, v;
-            iss >> u >> v;
-            uv.push_back({ u,v });
-        }
-        else if (tag == "f")
+        if (vao != 0)
         {
-            std::string tok;
-            std::vector<std::pair<int, int>> fverts;
-
-            while (iss >> tok)
-            {
-                int vi = -1, ti = -1;
-                size_t s = tok.find('/');
-                if (s == std::string::npos)
-                {
-                    vi = std::stoi(tok) - 1;
-                }
-                else
-                {
-                    vi = std::stoi(tok.substr(0, s)) - 1;
-                    std::string t = tok.substr(s + 1);
-                    if (!t.empty())
-                        ti = std::stoi(t) - 1;
-                }
-                fverts.push_back({ vi,ti });
-            }
-
-            for (int i = 1; i + 1 < (int)fverts.size(); ++i)
-            {
-                pushVert(fverts[0].first, fverts[0].second);
-                pushVert(fverts[i].first, fverts[i].second);
-                pushVert(fverts[i + 1].first, fverts[i + 1].second);
-            }
+            glDeleteVertexArrays(1, &vao);
+            GLuint bufs[3] = { vbo, ebo, instVBO };
+            glDeleteBuffers(3, bufs);
+            instVBO = 0;
+            instCapacity = 0;
         }
-    }
-    return !out.empty();
-}
-
-struct Model
-{
-    GLuint vao = 0, vbo = 0;
-    GLsizei count = 0;
-
-    bool load(const char* path)
-    {
-        std::vector<float> verts;
-        if (!LoadObj(path, verts))
-            return false;
 
         glGenVertexArrays(1, &vao);
         glGenBuffers(1, &vbo);
+        glGenBuffers(1, &ebo);
 
         glBindVertexArray(vao);
         glBindBuffer(GL_ARRAY_BUFFER, vbo);
 
         glBufferData(GL_ARRAY_BUFFER,
-            verts.size() * sizeof(float),
-            verts.data(), GL_STATIC_DRAW);
+            (GLsizeiptr)mesh.vertexCount * mesh.stride,
+            mesh.vertices, GL_STATIC_DRAW);
 
-        // pos
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE,
-            sizeof(float) * 5, (void*)0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+            (GLsizeiptr)mesh.indexCount * mesh.indexStride,
+            mesh.indices, GL_STATIC_DRAW);
+        indexType = mesh.indexStride == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
 
-        // uv
-        glEnableVertexAttribArray(1);
-        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE,
-            sizeof(float) * 5, (void*)(sizeof(float) * 3));
+        // 0 = pos, 1 = uv (파일에 적힌 배치 그대로)
+        for (uint32_t i = 0; i < mesh.attribCount; i++)
+        {
+            const MeshAttrib& a = mesh.attribs[i];
+            glEnableVertexAttribArray(a.location);
+            glVertexAttribPointer(a.location, a.components, GL_FLOAT, GL_FALSE,
+                mesh.stride, (void*)(uintptr_t)a.offset);
+        }
 
         glBindVertexArray(0);
-        count = (GLsizei)(verts.size() / 5);
-
-        return true;
+        count = (GLsizei)mesh.indexCount;
     }
 
     void draw(const mat4& MVP, const vec3& col, GLuint texID, bool textured)
     {
         if (vao == 0 || count == 0) return;
 
-        glUseProgram(gProgram);
+        gProgram.Use();
         glBindVertexArray(vao);
 
-        GLint mvpLoc = glGetUniformLocation(gProgram, "uMVP");
-        GLint colLoc = glGetUniformLocation(gProgram, "uColor");
-        GLint useTexLoc = glGetUniformLocation(gProgram, "uUseTexture");
-        GLint texLoc = glGetUniformLocation(gProgram, "uTex");
-
-        glUniformMatrix4fv(mvpLoc, 1, GL_FALSE, &MVP[0][0]);
-        glUniform3fv(colLoc, 1, &col[0]);
-        glUniform1i(useTexLoc, textured ? 1 : 0);
+        gProgram.Set(gProgramU.mvp, MVP);
+        gProgram.Set(gProgramU.color, col);
+        gProgram.Set(gProgramU.useTexture, textured ? 1 : 0);
 
         if (textured && texID != 0) {
             glActiveTexture(GL_TEXTURE0);
             glBindTexture(GL_TEXTURE_2D, texID);
-            glUniform1i(texLoc, 0);
+            gProgram.Set(gProgramU.tex, 0);
+        }
+
+        glDrawElements(GL_TRIANGLES, count, indexType, nullptr);
+
+        glBindVertexArray(0);
+    }
+
+    // 같은 모델 n개를 draw call 한 번으로 (gInstProgram)
+    void drawInstanced(const mat4& viewProj, const mat4* models, GLsizei n, GLuint texID)
+    {
+        if (vao == 0 || count == 0 || n == 0) return;
+
+        glBindVertexArray(vao);
+
+        if (instVBO == 0)
+        {
+            glGenBuffers(1, &instVBO);
+            glBindBuffer(GL_ARRAY_BUFFER, instVBO);
+            for (int k = 0; k < 4; k++)
+            {
+                glEnableVertexAttribArray(2 + k);
+                glVertexAttribPointer(2 + k, 4, GL_FLOAT, GL_FALSE,
+                    sizeof(mat4), (void*)(sizeof(glm::vec4) * k));
+                glVertexAttribDivisor(2 + k, 1);
+            }
         }
+        glBindBuffer(GL_ARRAY_BUFFER, instVBO);
+
+        // 모자라면 키우고, 아니면 버퍼를 새로 받아(orphan) 이전 프레임과 겹치지 않게
+        if (n > instCapacity)
+            instCapacity = n;
+        glBufferData(GL_ARRAY_BUFFER, sizeof(mat4) * instCapacity, nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(mat4) * n, models);
 
-        glDrawArrays(GL_TRIANGLES, 0, count);
+        gInstProgram.Use();
+        gInstProgram.Set(gInstProgramU.viewProj, viewProj);
+        gInstProgram.Set(gInstProgramU.color, vec3(1.0f));
+        gInstProgram.Set(gInstProgramU.useTexture, 1);
+        gInstProgram.Set(gInstProgramU.tex, 0);
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, texID);
+
+        glDrawElementsInstanced(GL_TRIANGLES, count, indexType, nullptr, n);
 
         glBindVertexArray(0);
     }
@@ -258,62 +200,95 @@ Model trayModel;
 Model diceModel;
 
 // =============================================================
-// 텍스처 로드
+// 에셋 (작업 스레드에서 읽고 GL 스레드에서 올린다, AssetLoader.h)
 // =============================================================
-GLuint LoadTexture(const char* path)
-{
-    // PNG가 위에서 아래 방향으로 저장된 경우 뒤집어서 로드
-    stbi_set_flip_vertically_on_load(true);
+AssetLoader gAssets;
 
-    int w, h, c;
-    unsigned char* buf = stbi_load(path, &w, &h, &c, 4);
+// Dice.obj 가 올 때까지 쓸 정육면체 (한 변 2, uv 는 면마다 0~1)
+MeshView PlaceholderCube()
+{
+    static float    verts[24 * 5];
+    static uint16_t indices[36];
+    static const int axis[6][3] = {   // 법선 축, u 축, v 축
+        { 0, 2, 1 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 0, 2 }, { 2, 0, 1 }, { 2, 0, 1 } };
 
-    if (!buf)
+    for (int f = 0; f < 6; f++)
     {
-        std::cerr << "Failed to load texture: " << path << std::endl;
-        return 0;
+        float sign = (f & 1) ? -1.0f : 1.0f;
+        for (int k = 0; k < 4; k++)
+        {
+            float u = (k == 1 || k == 2) ? 1.0f : 0.0f;
+            float v = (k >= 2) ? 1.0f : 0.0f;
+            float* o = &verts[(f * 4 + k) * 5];
+            o[axis[f][0]] = sign;
+            o[axis[f][1]] = (u * 2 - 1) * sign;
+            o[axis[f][2]] = v * 2 - 1;
+            o[3] = u;
+            o[4] = v;
+        }
+        static const uint16_t quad[6] = { 0, 1, 2, 0, 2, 3 };
+        for (int k = 0; k < 6; k++) indices[f * 6 + k] = (uint16_t)(f * 4 + quad[k]);
     }
 
-    GLuint tex;
-    glGenTextures(1, &tex);
-    glBindTexture(GL_TEXTURE_2D, tex);
-
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA,
-        w, h, 0,
-        GL_RGBA, GL_UNSIGNED_BYTE, buf);
-
-    glGenerateMipmap(GL_TEXTURE_2D);
-
-    glTexParameteri(GL_TEXTURE_2D,
-        GL_TEXTURE_MIN_FILTER,
-        GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D,
-        GL_TEXTURE_MAG_FILTER,
-        GL_LINEAR);
-
-    stbi_image_free(buf);
-    return tex;
+    MeshView mesh;
+    SetObjLayout(mesh);
+    mesh.vertices = verts;
+    mesh.indices = indices;
+    mesh.vertexCount = 24;
+    mesh.indexCount = 36;
+    mesh.indexStride = sizeof(uint16_t);
+    return mesh;
 }
 
 // =============================================================
-// Yacht Dice 구조체
+// 게임 상태 (YachtGame.h) / 주사위 표시용 상태
+//  - 눈, 고정, 점수는 gGame 에만 있고 여기서는 그리기만 한다
 // =============================================================
+GameState gGame;
+
 struct Die {
-    int   value;
-    bool  held;
     vec3  pos;
     vec3  rotAxis;
     float angle;
+    float prevAngle;    // 직전 시뮬레이션 step 의 angle (보간용)
 };
 
 Die gDice[5];
 
+// 부하 테스트용 장식 주사위 (--stress N, 게임과 무관)
+std::vector<mat4> gStressModels;
+std::vector<mat4> gDiceModels;   // 매 프레임 인스턴스 버퍼로 올릴 행렬
+
 bool  gRolling = false;
 float gRollTimer = 0;
 const float ROLL_DUR = 0.6f;
 
-int gTurn = 1;
-int gRollCount = 0;
+// 시뮬레이션은 실제 흐른 시간으로 SIM_STEP 씩 진행 (FrameClock.h)
+const double SIM_STEP = 1.0 / 120.0;
+FrameClock   gClock;
+FixedStep    gSimStep(SIM_STEP);
+
+// =============================================================
+// 다시 그리기 예약
+//  - 바뀐 것이 있을 때만 그린다 (가만히 있는 보드는 창이 다시 보일 때 말고는 그리지 않음)
+//  - 타이머는 굴리는 중이거나 에셋을 읽는 중에만 돈다
+// =============================================================
+bool gTimerRunning = false;
+bool gHeadless = false;       // --headless: GLUT 루프 없이 RunHeadless 가 직접 그린다
+
+void Timer(int);
+
+void MarkDirty()
+{
+    if (!gHeadless) glutPostRedisplay();    // 여러 번 불러도 다음 루프에서 한 번만 그린다
+}
+
+void StartTimer()
+{
+    if (gTimerRunning || gHeadless) return;
+    gTimerRunning = true;
+    glutTimerFunc(30, Timer, 0);
+}
 
 // =============================================================
 // 주사위 값에 따른 "기본 자세" 회전
@@ -370,113 +345,42 @@ mat4 GetValueRotation(int value)
 }
 
 // =============================================================
-// 주사위 점수 계산
+// 전략 테이블 힌트 (yacht_strategy_game.bin 이 있을 때만)
+//  - 이 게임 규칙 (나눠 준 뒤 MAX_ROLLS 번 다시 굴리기) 으로 푼 테이블: yacht_solver --game
+//    콘솔용 yacht_strategy.bin 은 한 번 덜 굴리는 규칙이라 쓰지 않는다
 // =============================================================
-std::vector<int> CountDice()
-{
-    std::vector<int> c(7, 0);
-    for (int i = 0; i < 5; i++)
-        c[gDice[i].value]++;
-
-    return c;
-}
-
-int ScoreUpper(int face)
-{
-    auto c = CountDice();
-    return c[face] * face;
-}
-
-int ScoreChoice()
-{
-    int s = 0;
-    for (int i = 0; i < 5; i++) s += gDice[i].value;
-    return s;
-}
-
-int ScoreFourKind()
-{
-    auto c = CountDice();
-    int tot = ScoreChoice();
-    for (int v = 1; v <= 6; v++)
-        if (c[v] >= 4) return tot;
-    return 0;
-}
+MappedStrategy gStrategy;
 
-int ScoreFullHouse()
+bool HintText(char* buf)
 {
-    auto c = CountDice();
-    bool t = false, d = false;
-    for (int v = 1; v <= 6; v++)
+    const StrategyView& st = gStrategy.view;
+    if (!st.IsValid() || gRolling || gGame.IsOver()) return false;
+
+    // 상태가 그대로면 지난번 문자열 재사용 (~0 은 올바른 상태 코드가 아님)
+    static uint64_t lastCode = ~0ull;
+    static char     lastText[64];
+    uint64_t code = PackState(gGame);
+    if (code != lastCode)
     {
-        if (c[v] == 3) t = true;
-        if (c[v] == 2) d = true;
-    }
-    return (t && d) ? 25 : 0;
-}
-
-int ScoreSmallStraight()
-{
-    auto c = CountDice();
-    bool s1 = c[1] && c[2] && c[3] && c[4];
-    bool s2 = c[2] && c[3] && c[4] && c[5];
-    bool s3 = c[3] && c[4] && c[5] && c[6];
-    return (s1 || s2 || s3) ? 30 : 0;
-}
-
-int ScoreLargeStraight()
-{
-    auto c = CountDice();
-    bool s1 = c[1] && c[2] && c[3] && c[4] && c[5];
-    bool s2 = c[2] && c[3] && c[4] && c[5] && c[6];
-    return (s1 || s2) ? 40 : 0;
-}
-
-int ScoreYacht()
-{
-    auto c = CountDice();
-    for (int v = 1; v <= 6; v++)
-        if (c[v] == 5) return 50;
-    return 0;
-}
-
-// =============================================================
-// 카테고리
-// =============================================================
-enum CategoryType {
-    ACES, DEUCES, THREES, FOURS, FIVES, SIXES,
-    CHOICE, FOURKIND, FULLHOUSE,
-    SSTRAIGHT, LSTRAIGHT, YACHT,
-    CATCOUNT
-};
-
-struct Category {
-    const char* name;
-    bool used;
-    int score;
-};
+        lastCode = code;
 
-Category gCat[CATCOUNT] = {
-    {"Aces",false,0},
-    {"Deuces",false,0},
-    {"Threes",false,0},
-    {"Fours",false,0},
-    {"Fives",false,0},
-    {"Sixes",false,0},
-    {"Choice",false,0},
-    {"4 of a Kind",false,0},
-    {"Full House",false,0},
-    {"S. Straight",false,0},
-    {"L. Straight",false,0},
-    {"Yacht",false,0},
-};
+        const DiceHand& hand = gGame.dice;
+        uint16_t mask = gGame.card.usedMask;
+        int rollsLeft = MAX_ROLLS - gGame.rollCount;
+        int hold = rollsLeft > 0 ? st.BestHold(mask, rollsLeft, hand) : HOLD_MASKS - 1;
 
-int TotalScore()
-{
-    int s = 0;
-    for (int i = 0; i < CATCOUNT; i++)
-        s += gCat[i].score;
-    return s;
+        if (hold == HOLD_MASKS - 1)
+            sprintf(lastText, "HINT: %s", CATEGORY_NAMES[st.BestCategory(mask, hand)]);
+        else
+        {
+            int n = sprintf(lastText, "HINT: hold");
+            if (hold == 0) n += sprintf(lastText + n, " none");
+            for (int i = 0; i < DICE_COUNT; i++)
+                if (hold & (1 << i)) n += sprintf(lastText + n, " %d", i + 1);
+        }
+    }
+    strcpy(buf, lastText);
+    return true;
 }
 
 // =============================================================
@@ -490,68 +394,183 @@ void InitDice()
 
     for (int i = 0; i < 5; i++)
     {
-        gDice[i].value = distVal(rng);
-        gDice[i].held = false;
         gDice[i].pos = vec3(start + step * i, 3.0f, 0.0f);
         gDice[i].rotAxis = glm::normalize(vec3(distF(rng), 1.0f, distF(rng)));
         gDice[i].angle = 0.0f;
+        gDice[i].prevAngle = 0.0f;
     }
-    gRollCount = 0;
+    gGame = GameState::New(gSeed);
 }
 
 
+// =============================================================
+// 부하 테스트 주사위: 바닥판 위에 n개를 격자로 깔아 둔다
+// =============================================================
+void InitStressDice(int n)
+{
+    gStressModels.clear();
+    if (n <= 0) return;
+
+    int cols = (int)std::ceil(std::sqrt(n * 11.0f / 9.0f));
+    int rows = (n + cols - 1) / cols;
+    float dx = 11.0f / cols, dz = 9.0f / rows;
+
+    for (int i = 0; i < n; i++)
+    {
+        mat4 M(1.0f);
+        M = glm::translate(M, vec3(-5.5f + dx * (i % cols + 0.5f), -0.7f, -4.5f + dz * (i / cols + 0.5f)));
+        M = glm::rotate(M, glm::radians(37.0f * i), vec3(0, 1, 0));
+        M *= GetValueRotation(i % 6 + 1);
+        M = glm::scale(M, vec3(0.5f * std::min(1.0f, std::min(dx, dz))));
+        gStressModels.push_back(M);
+    }
+}
+
 // =============================================================
 // 주사위 굴리기
 // =============================================================
 void StartRoll()
 {
     if (gRolling) return;
-    if (gRollCount >= 3) return;
+    if (!gGame.IsLegal(RollAction())) return;
 
+    gGame = gGame.Apply(RollAction());
     for (int i = 0; i < 5; i++)
     {
-        if (gDice[i].held) continue;
-        gDice[i].value = distVal(rng);
+        if (gGame.IsHeld(i)) continue;
         gDice[i].rotAxis = glm::normalize(vec3(distF(rng), 1.0f, distF(rng)));
         gDice[i].angle = 0.0f;
+        gDice[i].prevAngle = 0.0f;
     }
     gRolling = true;
     gRollTimer = 0.0f;
-    gRollCount++;
+
+    // 멈춰 있던 동안의 시간은 애니메이션에 넣지 않는다
+    gClock.Reset();
+    gSimStep.Reset();
+
+    MarkDirty();
+    StartTimer();
 }
 
 // =============================================================
-// 텍스트 출력
+// 시뮬레이션 한 step (항상 SIM_STEP 초)
 // =============================================================
-void DrawText(float x, float y, const char* s)
+void StepSimulation(float dt)
 {
-    glRasterPos2f(x, y);
-    while (*s)
+    if (!gRolling) return;
+
+    gRollTimer += dt;
+    float t = gRollTimer / ROLL_DUR;
+    if (t > 1) t = 1;
+
+    for (int i = 0; i < 5; i++)
     {
-        glutBitmapCharacter(GLUT_BITMAP_8_BY_13, *s);
-        s++;
+        gDice[i].prevAngle = gDice[i].angle;
+        if (!gGame.IsHeld(i))
+            gDice[i].angle = 360.0f * t * 2;
+    }
+
+    if (gRollTimer >= ROLL_DUR)
+    {
+        gRolling = false;
+        for (int i = 0; i < 5; i++)
+            gDice[i].angle = gDice[i].prevAngle = 0;
     }
 }
 
+// =============================================================
+// 흐른 시간만큼 시뮬레이션 진행 (남는 시간은 다음 번으로)
+//  - 창 루프에서는 gClock.Tick(), 헤드리스에서는 원하는 dt 를 직접
+// =============================================================
+void Simulate(double dt)
+{
+    int steps = gSimStep.Advance(dt);
+    for (int i = 0; i < steps; i++)
+        StepSimulation((float)SIM_STEP);
+}
+
+// =============================================================
+// 텍스트 출력 (점수판 좌표: 왼쪽 1/3 영역 기준 0~1)
+//  - gText 에 쌓기만 하고, 실제 그리기는 gText.Flush()
+// =============================================================
+void DrawText(float x, float y, const char* s)
+{
+    gText.Text(x * (gWidth / 3), y * gHeight, s);
+}
+
 // =============================================================
 // 텍스트 출력 (0~gWidth, 0~gHeight 픽셀 좌표용)
 // =============================================================
 void DrawTextPixel(float x, float y, const char* s)
 {
-    glRasterPos2f(x, y);
-    while (*s)
+    gText.Text(x, y, s);
+}
+
+
+// =============================================================
+// 점수판 내용 (왼쪽 1/3, gText 에 쌓기만 한다)
+// =============================================================
+void DrawScoreboard()
+{
+    int leftW = gWidth / 3;
+
+    // 배경
+    gText.Rect(0.0f, 0.0f, (float)leftW, (float)gHeight, TextColor(0.98f, 0.96f, 0.60f));
+
+    char buf[128];
+    float Y = 0.95f;
+
+    DrawText(0.05f, Y, "YACHT SCORE BOARD");
+    Y -= 0.06f;
+
+    sprintf(buf, "Turn %d / 12    Roll %d / 3", gGame.Turn() + 1, gGame.rollCount);
+    DrawText(0.05f, Y, buf); Y -= 0.06f;
+
+    DrawText(0.05f, Y, "SPACE: Roll   1-5 : Hold");
+    Y -= 0.05f;
+
+    DrawText(0.05f, Y, "A-F: Aces~Sixes,  G:Choice  H:4Kind  J:Full");
+    Y -= 0.05f;
+    DrawText(0.05f, Y, "K:S.S   L:L.S   Y:Yacht");
+    Y -= 0.05f;
+
+    if (HintText(buf)) DrawText(0.05f, Y, buf);
+    Y -= 0.05f;
+
+    for (int i = 0; i < CATCOUNT; i++)
     {
-        glutBitmapCharacter(GLUT_BITMAP_8_BY_13, *s);
-        ++s;
+        sprintf(buf, "%2d. %-12s : %3d %s",
+            i + 1, CATEGORY_NAMES[i], gGame.card.score[i],
+            gGame.card.IsUsed(i) ? "*" : "");
+        DrawText(0.05f, Y, buf);
+        Y -= 0.045f;
     }
-}
 
+    sprintf(buf, "TOTAL : %d", gGame.card.Total());
+    DrawText(0.05f, 0.04f, buf);
+}
 
 // =============================================================
-// Display
+// 한 프레임 그리기 (창의 Display 와 헤드리스 FBO 가 같은 장면을 쓴다)
 // =============================================================
-void Display()
+void RenderFrame()
 {
+    // step 사이는 보간
+    float alpha = gSimStep.Alpha();
+
+    // ---------- 2D Scoreboard ----------
+    // 게임 상태나 굴리는 중인지(힌트 표시)가 바뀔 때만 텍스처에 다시 그린다 (평소에는 붙이기만)
+    //  - 프레임 맨 앞에서 해야 장면을 그리다 말고 렌더 타깃을 바꾸지 않는다
+    uint64_t panelKey[2] = { PackState(gGame), gRolling ? 1u : 0u };
+    if (gPanel.Begin(gWidth / 3, gHeight, panelKey, sizeof(panelKey)))
+    {
+        DrawScoreboard();
+        gText.Flush(gWidth / 3, gHeight);
+        gPanel.End();
+    }
+    gProfiler.Mark(PHASE_SCOREBOARD);
+
     glClearColor(0.85f, 0.85f, 0.85f, 1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -574,14 +593,12 @@ void Display()
         mat4 M(1.0f);
         M = glm::translate(M, vec3(0.0f, -1.4f, 0.0f));
         M = glm::scale(M, vec3(12.0f, 0.4f, 10.0f));
-        glUseProgram(gProgram);
-        glUniform1i(glGetUniformLocation(gProgram, "uUseTexture"), 0);
+        gProgram.Use();
+        gProgram.Set(gProgramU.useTexture, 0);
 
         glBindVertexArray(gCubeVAO);
-        glUniformMatrix4fv(glGetUniformLocation(gProgram, "uMVP"),
-            1, GL_FALSE, &(proj * view * M)[0][0]);
-        glUniform3f(glGetUniformLocation(gProgram, "uColor"),
-            0.65f, 0.45f, 0.25f);
+        gProgram.Set(gProgramU.mvp, proj * view * M);
+        gProgram.Set(gProgramU.color, vec3(0.65f, 0.45f, 0.25f));
         glDrawArrays(GL_TRIANGLES, 0, 36);
     }
 
@@ -594,8 +611,9 @@ void Display()
         trayModel.draw(proj * view * model, vec3(1.0f), gTrayTex, true);
     }
 
-    // 주사위 5개 OBJ (텍스처)
+    // 주사위 OBJ (텍스처) - 게임 주사위 5개 + 부하 테스트 주사위를 한 번에
     {
+        gDiceModels.clear();
         for (int i = 0; i < 5; i++)
         {
             mat4 M(1.0f);
@@ -604,44 +622,32 @@ void Display()
             M = glm::translate(M, gDice[i].pos);
 
             // 값에 따른 기본 회전 (윗면 맞추기)
-            M *= GetValueRotation(gDice[i].value);
+            M *= GetValueRotation(gGame.dice.value[i]);
 
             // 굴리는 중이면 추가 회전
-            if (gRolling && !gDice[i].held)
+            if (gRolling && !gGame.IsHeld(i))
             {
+                float angle = glm::mix(gDice[i].prevAngle, gDice[i].angle, alpha);
                 M = glm::rotate(M,
-                    glm::radians(gDice[i].angle),
+                    glm::radians(angle),
                     gDice[i].rotAxis);
             }
 
             // 크기
             M = glm::scale(M, vec3(0.5f));
 
-            diceModel.draw(proj * view * M, vec3(1.0f), gDiceTex, true);
+            gDiceModels.push_back(M);
         }
+        gDiceModels.insert(gDiceModels.end(), gStressModels.begin(), gStressModels.end());
+
+        diceModel.drawInstanced(proj * view, gDiceModels.data(), (GLsizei)gDiceModels.size(), gDiceTex);
     }
+    gProfiler.Mark(PHASE_SCENE);
 
     // ---------------------------------------------------------
     // 주사위 값 디버그용: 각 주사위 위에 숫자 출력
     // ---------------------------------------------------------
     {
-        glUseProgram(0);
-        glDisable(GL_DEPTH_TEST);
-
-        // 전체 윈도우 기준 픽셀 좌표로 오버레이
-        glViewport(0, 0, gWidth, gHeight);
-
-        glMatrixMode(GL_PROJECTION);
-        glPushMatrix();
-        glLoadIdentity();
-        glOrtho(0.0, (double)gWidth, 0.0, (double)gHeight, -1.0, 1.0);
-
-        glMatrixMode(GL_MODELVIEW);
-        glPushMatrix();
-        glLoadIdentity();
-
-        glColor3f(0.0f, 0.0f, 0.0f);
-
         // 3D → 2D 변환용 뷰포트(오른쪽 3D 영역)
         glm::vec4 vp((float)rightX, 0.0f, (float)rightW, (float)gHeight);
 
@@ -654,76 +660,33 @@ void Display()
             glm::vec3 winPos = glm::project(worldPos, view, proj, vp);
 
             char buf[8];
-            sprintf(buf, "%d", gDice[i].value);
+            sprintf(buf, "%d", gGame.dice.value[i]);
 
             // 숫자 살짝 위로 올리고 출력
             DrawTextPixel(winPos.x, winPos.y + 10.0f, buf);
         }
-
-        glPopMatrix();              // MODELVIEW
-        glMatrixMode(GL_PROJECTION);
-        glPopMatrix();
-        glMatrixMode(GL_MODELVIEW);
     }
+    gProfiler.Mark(PHASE_LABELS);
 
-    // ---------- 2D Scoreboard ----------
-    glDisable(GL_DEPTH_TEST);
-    glUseProgram(0);
-
-    glViewport(0, 0, leftW, gHeight);
-
-    glMatrixMode(GL_PROJECTION);
-    glPushMatrix();
-    glLoadIdentity();
-    glOrtho(0, 1, 0, 1, -1, 1);
-
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
-    glLoadIdentity();
-
-    // 배경
-    glColor3f(0.98f, 0.96f, 0.60f);
-    glBegin(GL_QUADS);
-    glVertex2f(0, 0);
-    glVertex2f(1, 0);
-    glVertex2f(1, 1);
-    glVertex2f(0, 1);
-    glEnd();
-
-    glColor3f(0, 0, 0);
-
-    char buf[128];
-    float Y = 0.95f;
-
-    DrawText(0.05f, Y, "YACHT SCORE BOARD");
-    Y -= 0.06f;
-
-    sprintf(buf, "Turn %d / 12    Roll %d / 3", gTurn, gRollCount);
-    DrawText(0.05f, Y, buf); Y -= 0.06f;
-
-    DrawText(0.05f, Y, "SPACE: Roll   1-5 : Hold");
-    Y -= 0.05f;
-
-    DrawText(0.05f, Y, "A-F: Aces~Sixes,  G:Choice  H:4Kind  J:Full");
-    Y -= 0.05f;
-    DrawText(0.05f, Y, "K:S.S   L:L.S   Y:Yacht");
-    Y -= 0.08f;
+    // 점수판 붙이기 + 주사위 숫자를 draw call 한 번으로
+    glViewport(0, 0, gWidth, gHeight);
+    gPanel.Draw(gWidth, gHeight);
+    gText.Flush(gWidth, gHeight);
+    gProfiler.Mark(PHASE_OVERLAY);
+}
 
-    for (int i = 0; i < CATCOUNT; i++)
-    {
-        sprintf(buf, "%2d. %-12s : %3d %s",
-            i + 1, gCat[i].name, gCat[i].score,
-            gCat[i].used ? "*" : "");
-        DrawText(0.05f, Y, buf);
-        Y -= 0.045f;
-    }
+// =============================================================
+// Display
+// =============================================================
+void Display()
+{
+    // 다 읽은 에셋 올리기
+    gAssets.Poll();
 
-    sprintf(buf, "TOTAL : %d", TotalScore());
-    DrawText(0.05f, 0.04f, buf);
+    // 그리기 직전까지 시뮬레이션을 따라잡는다
+    Simulate(gClock.Tick());
 
-    glPopMatrix();
-    glMatrixMode(GL_PROJECTION);
-    glPopMatrix();
+    RenderFrame();
 
     glutSwapBuffers();
 }
@@ -733,30 +696,37 @@ void Display()
 // =============================================================
 void Timer(int)
 {
-    float dt = 0.03f;
+    gTimerRunning = false;
 
+    // 타이머가 늦게 와도 실제 흐른 시간만큼 진행
     if (gRolling)
     {
-        gRollTimer += dt;
-        float t = gRollTimer / ROLL_DUR;
-        if (t > 1) t = 1;
+        Simulate(gClock.Tick());
+        MarkDirty();
+    }
 
-        for (int i = 0; i < 5; i++)
-        {
-            if (!gDice[i].held)
-                gDice[i].angle = 360.0f * t * 2;
-        }
+    // 작업 스레드가 끝낸 에셋은 Display 의 Poll() 에서 올라간다
+    if (gAssets.HasDone()) MarkDirty();
 
-        if (gRollTimer >= ROLL_DUR)
-        {
-            gRolling = false;
-            for (int i = 0; i < 5; i++)
-                gDice[i].angle = 0;
-        }
-    }
+    if (gRolling || !gAssets.IsIdle()) StartTimer();
+}
 
-    glutPostRedisplay();
-    glutTimerFunc(30, Timer, 0);
+// =============================================================
+// 규칙에 맞는 행동만 적용하고 다시 그리기 예약 (틀린 행동은 무시)
+// =============================================================
+void ApplyAction(const Action& a)
+{
+    if (!gGame.IsLegal(a)) return;
+    gGame = gGame.Apply(a);
+    MarkDirty();
+}
+
+// =============================================================
+// 족보 기록 (이미 기록한 카테고리는 무시)
+// =============================================================
+void RecordCategory(CategoryType cat)
+{
+    ApplyAction(RecordAction(cat));
 }
 
 // =============================================================
@@ -766,8 +736,7 @@ void Keyboard(unsigned char key, int, int)
 {
     if (key >= '1' && key <= '5')
     {
-        int idx = key - '1';
-        gDice[idx].held = !gDice[idx].held;
+        ApplyAction(HoldAction(key - '1'));
         return;
     }
 
@@ -778,95 +747,57 @@ void Keyboard(unsigned char key, int, int)
         break;
 
     case 'a': case 'A':
-        if (!gCat[ACES].used) {
-            gCat[ACES].used = true;
-            gCat[ACES].score = ScoreUpper(1);
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(ACES);
+        break;
 
     case 'b': case 'B':
-        if (!gCat[DEUCES].used) {
-            gCat[DEUCES].used = true;
-            gCat[DEUCES].score = ScoreUpper(2);
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(DEUCES);
+        break;
 
     case 'c': case 'C':
-        if (!gCat[THREES].used) {
-            gCat[THREES].used = true;
-            gCat[THREES].score = ScoreUpper(3);
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(THREES);
+        break;
 
     case 'd': case 'D':
-        if (!gCat[FOURS].used) {
-            gCat[FOURS].used = true;
-            gCat[FOURS].score = ScoreUpper(4);
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(FOURS);
+        break;
 
     case 'e': case 'E':
-        if (!gCat[FIVES].used) {
-            gCat[FIVES].used = true;
-            gCat[FIVES].score = ScoreUpper(5);
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(FIVES);
+        break;
 
     case 'f': case 'F':
-        if (!gCat[SIXES].used) {
-            gCat[SIXES].used = true;
-            gCat[SIXES].score = ScoreUpper(6);
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(SIXES);
+        break;
 
     case 'g': case 'G':
-        if (!gCat[CHOICE].used) {
-            gCat[CHOICE].used = true;
-            gCat[CHOICE].score = ScoreChoice();
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(CHOICE);
+        break;
 
     case 'h': case 'H':
-        if (!gCat[FOURKIND].used) {
-            gCat[FOURKIND].used = true;
-            gCat[FOURKIND].score = ScoreFourKind();
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(FOURKIND);
+        break;
 
     case 'j': case 'J':
-        if (!gCat[FULLHOUSE].used) {
-            gCat[FULLHOUSE].used = true;
-            gCat[FULLHOUSE].score = ScoreFullHouse();
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(FULLHOUSE);
+        break;
 
     case 'k': case 'K':
-        if (!gCat[SSTRAIGHT].used) {
-            gCat[SSTRAIGHT].used = true;
-            gCat[SSTRAIGHT].score = ScoreSmallStraight();
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(SSTRAIGHT);
+        break;
 
     case 'l': case 'L':
-        if (!gCat[LSTRAIGHT].used) {
-            gCat[LSTRAIGHT].used = true;
-            gCat[LSTRAIGHT].score = ScoreLargeStraight();
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(LSTRAIGHT);
+        break;
 
     case 'y': case 'Y':
-        if (!gCat[YACHT].used) {
-            gCat[YACHT].used = true;
-            gCat[YACHT].score = ScoreYacht();
-            InitDice(); gTurn++;
-        } break;
+        RecordCategory(YACHT);
+        break;
 
     case 27:
         exit(0);
         break;
     }
-
-    glutPostRedisplay();
 }
 
 // =============================================================
@@ -877,7 +808,12 @@ void InitGL()
     glewInit();
     glEnable(GL_DEPTH_TEST);
 
-    gProgram = CreateProgram();
+    gProgram.Create("vertex.glsl", "fragment.glsl");
+    gInstProgram.Create("vertex_instanced.glsl", "fragment.glsl");
+    gProgramU.Find(gProgram);
+    gInstProgramU.Find(gInstProgram);
+    gPanel.Init(gProgram);
+    gText.Init("vertex_text.glsl", "fragment_text.glsl");
 
     // 단색 큐브 (바닥용)
     float s = 0.5f;
@@ -917,22 +853,216 @@ void InitGL()
 
     glBindVertexArray(0);
 
-    // OBJ 로드
-    trayModel.load("Yacht.obj");
-    diceModel.load("Dice.obj");
+    // 메시 / 텍스처는 작업 스레드에서 읽고, 올 때까지 자리 표시로 그린다
+    //  (트레이는 다 읽을 때까지 그리지 않음)
+    gDiceTex = CreatePlaceholderTexture(255, 255, 255);
+    gTrayTex = CreatePlaceholderTexture(200, 170, 120);
+    diceModel.upload(PlaceholderCube());
+
+    gAssets.Start();
+    gAssets.Load<MeshAsset>("Yacht.obj", [](MeshAsset& a) { trayModel.upload(a.view); });
+    gAssets.Load<MeshAsset>("Dice.obj", [](MeshAsset& a) { diceModel.upload(a.view); });
+    gAssets.Load<ImageAsset>("Dice.png", [](ImageAsset& a) { UploadTexture(gDiceTex, a.view); });
+    gAssets.Load<ImageAsset>("Yachtboard.png", [](ImageAsset& a) { UploadTexture(gTrayTex, a.view); });
 
-    // 텍스처 로드
-    gDiceTex = LoadTexture("Dice.png");
-    gTrayTex = LoadTexture("Yachtboard.png");
+    // 전략 테이블 (없으면 힌트 없이 진행)
+    gStrategy.Open("yacht_strategy_game.bin", GAME_STAGE_COUNT);
 
     InitDice();
 }
 
+// =============================================================
+// 헤드리스 실행 (창 / GPU 없이 FBO 에 그리기, Headless.h)
+//  yacht --headless [--frames N] [--size WxH] [--seed S] [--keys " 1a"]
+//                   [--dump DIR] [--golden DIR] [--tolerance T] [--stress N]
+//  - 시뮬레이션은 실제 시간이 아니라 프레임마다 1/60 초씩 (빠르고 항상 같은 결과)
+//  - --keys: 굴리기가 끝날 때마다 한 글자씩 Keyboard() 로 보낸다 (기본 " " = 한 번 굴리기)
+//  - --dump: DIR/frame_0000.ppm ... 저장
+//  - --golden: DIR 의 같은 이름 프레임과 비교, 채널 차이가 T(기본 2) 를 넘는
+//    픽셀이 있으면 실패 (종료 코드 1)
+//
+//  벤치마크: --bench [--json FILE] [--warmup W]
+//  - 단계별 CPU / GPU 시간의 평균, p50 / p95 / p99 (FrameProfiler.h)
+//  - --keys 가 없으면 BENCH_KEYS (12턴 한 판) 를 재생, 기본 1500 프레임
+//  - 앞의 W(기본 10) 프레임은 통계에서 뺀다
+// =============================================================
+const char* BENCH_KEYS =
+    " 1 2 a" " 1 2 b" " 1 2 c" " 1 2 d" " 1 2 e" " 1 2 f"
+    " 1 2 g" " 1 2 h" " 1 2 j" " 1 2 k" " 1 2 l" " 1 2 y";
+
+// JSON 문자열 안에 넣을 수 있게 (따옴표, 역슬래시, 제어 문자)
+std::string JsonEscape(const char* s)
+{
+    std::string out;
+    for (; *s; s++)
+    {
+        if (*s == '"' || *s == '\\') out += '\\';
+        if ((unsigned char)*s < 0x20) continue;
+        out += *s;
+    }
+    return out;
+}
+
+const char* ArgValue(int argc, char** argv, const char* name)
+{
+    for (int i = 1; i + 1 < argc; i++)
+        if (!strcmp(argv[i], name)) return argv[i + 1];
+    return nullptr;
+}
+
+int RunHeadless(int argc, char** argv)
+{
+    gHeadless = true;
+
+    bool bench = false;
+    for (int i = 1; i < argc; i++) bench |= !strcmp(argv[i], "--bench");
+
+    int frames = bench ? 1500 : 60, tolerance = 2, warmup = 10;
+    const char* keys = bench ? BENCH_KEYS : " ";
+    const char* script = keys;
+    const char* dumpDir = ArgValue(argc, argv, "--dump");
+    const char* goldenDir = ArgValue(argc, argv, "--golden");
+    const char* jsonPath = ArgValue(argc, argv, "--json");
+    if (const char* v = ArgValue(argc, argv, "--frames")) frames = atoi(v);
+    if (const char* v = ArgValue(argc, argv, "--size")) sscanf(v, "%dx%d", &gWidth, &gHeight);
+    if (const char* v = ArgValue(argc, argv, "--keys")) keys = script = v;
+    if (const char* v = ArgValue(argc, argv, "--tolerance")) tolerance = atoi(v);
+    if (const char* v = ArgValue(argc, argv, "--warmup")) warmup = atoi(v);
+
+    HeadlessContext ctx;
+    if (!ctx.Create(argc, argv)) return 1;
+
+    InitGL();
+    std::cout << "renderer: " << glGetString(GL_RENDERER) << " | " << glGetString(GL_VERSION) << std::endl;
+
+    RenderTarget target;
+    if (!target.Create(gWidth, gHeight)) return 1;
+    target.Bind();
+
+    if (const char* v = ArgValue(argc, argv, "--stress")) InitStressDice(atoi(v));
+
+    // 골든 이미지와 비교하려면 에셋이 전부 올라간 뒤부터 그려야 한다
+    while (!gAssets.IsIdle())
+    {
+        gAssets.Poll();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    if (dumpDir) std::filesystem::create_directories(dumpDir);
+    if (bench) gProfiler.Start(true);
+
+    std::vector<uint8_t> rgb, golden;
+    int failed = 0, mismatched = 0;
+    double totalMs = 0;
+    for (int f = 0; f < frames; f++)
+    {
+        if (!gRolling && *keys) Keyboard((unsigned char)*keys++, 0, 0);
+
+        auto t0 = std::chrono::steady_clock::now();
+        Simulate(1.0 / 60.0);
+        gProfiler.BeginFrame();
+        RenderFrame();
+        glFinish();
+        gProfiler.Mark(PHASE_FINISH);
+        gProfiler.EndFrame();
+        totalMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+        if (!dumpDir && !goldenDir) continue;
+
+        char name[32];
+        sprintf(name, "frame_%04d.ppm", f);
+        target.Read(rgb);
+
+        if (dumpDir && !WritePPM((std::filesystem::path(dumpDir) / name).string().c_str(), gWidth, gHeight, rgb))
+        {
+            std::cerr << "Failed to write frame: " << name << std::endl;
+            failed++;
+        }
+
+        if (goldenDir)
+        {
+            int gw, gh;
+            std::string path = (std::filesystem::path(goldenDir) / name).string();
+            if (!ReadPPM(path.c_str(), gw, gh, golden)) {
+                std::cerr << "Missing golden frame: " << path << std::endl;
+                failed++;
+                continue;
+            }
+            FrameDiff d = DiffFrames(rgb, golden, tolerance);
+            if (d.pixels != 0)
+            {
+                std::cout << name << ": " << (d.pixels < 0 ? "size mismatch" : "differs")
+                    << " (" << d.pixels << " pixels, max delta " << d.maxDelta << ")" << std::endl;
+                mismatched++;
+            }
+        }
+    }
+
+    printf("%d frames, %dx%d, %.3f ms/frame (render + glFinish)\n",
+        frames, gWidth, gHeight, frames ? totalMs / frames : 0.0);
+    if (goldenDir) printf("golden: %d of %d frames differ\n", mismatched, frames);
+
+    if (bench)
+    {
+        gProfiler.Finish();
+        gProfiler.Print(warmup);
+
+        FILE* f = jsonPath ? fopen(jsonPath, "w") : nullptr;
+        if (jsonPath && !f) {
+            std::cerr << "Failed to write report: " << jsonPath << std::endl;
+            failed++;
+        }
+        if (f)
+        {
+            fprintf(f, "{\n");
+            fprintf(f, "  \"renderer\": \"%s\",\n", JsonEscape((const char*)glGetString(GL_RENDERER)).c_str());
+            fprintf(f, "  \"gl_version\": \"%s\",\n", JsonEscape((const char*)glGetString(GL_VERSION)).c_str());
+            fprintf(f, "  \"width\": %d,\n  \"height\": %d,\n", gWidth, gHeight);
+            fprintf(f, "  \"frames\": %d,\n  \"warmup\": %d,\n", frames, warmup);
+            fprintf(f, "  \"stress_dice\": %d,\n", (int)gStressModels.size());
+            fprintf(f, "  \"keys\": \"%s\",\n", JsonEscape(script).c_str());
+            gProfiler.WriteJson(f, warmup);
+            fprintf(f, "}\n");
+            fclose(f);
+        }
+    }
+
+    gAssets.Stop();
+    target.Destroy();
+    ctx.Destroy();
+    return failed || mismatched ? 1 : 0;
+}
+
 // =============================================================
 // main
 // =============================================================
 int main(int argc, char** argv)
 {
+    // yacht --bake Yacht.obj Dice.obj Dice.png ... : 캐시만 만들고 종료 (배포 전 굽기용)
+    //  .obj -> .obj.ymesh (메시), 그 밖의 이미지 -> .ytex (밉맵 텍스처)
+    if (argc >= 2 && !strcmp(argv[1], "--bake"))
+    {
+        int failed = 0;
+        for (int i = 2; i < argc; i++)
+        {
+            size_t len = strlen(argv[i]);
+            bool obj = len >= 4 && !strcmp(argv[i] + len - 4, ".obj");
+            bool ok = obj ? BakeMesh(argv[i]) : BakeTexture(argv[i]);
+            std::string out = obj ? MeshCachePath(argv[i]) : TextureCachePath(argv[i]);
+            std::cout << (ok ? "baked  " : "FAILED ") << out << std::endl;
+            failed += !ok;
+        }
+        return failed ? 1 : 0;
+    }
+
+    // yacht --seed S : 주사위 / 게임 난수 고정 (헤드리스는 기본 1)
+    if (const char* v = ArgValue(argc, argv, "--seed")) gSeed = strtoull(v, nullptr, 0);
+    else if (argc >= 2 && !strcmp(argv[1], "--headless")) gSeed = 1;
+    rng = Xoshiro256pp(gSeed);
+
+    if (argc >= 2 && !strcmp(argv[1], "--headless"))
+        return RunHeadless(argc, argv);
+
     glutInit(&argc, argv);
     glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA | GLUT_DEPTH);
     glutInitWindowSize(gWidth, gHeight);
@@ -940,10 +1070,14 @@ int main(int argc, char** argv)
 
     InitGL();
 
+    // yacht --stress N : 장식 주사위 N개를 더 그린다
+    for (int i = 1; i + 1 < argc; i++)
+        if (!strcmp(argv[i], "--stress")) InitStressDice(atoi(argv[i + 1]));
+
     glutDisplayFunc(Display);
-    glutReshapeFunc([](int w, int h) { gWidth = w; gHeight = h; });
+    glutReshapeFunc([](int w, int h) { gWidth = w; gHeight = h; MarkDirty(); });
     glutKeyboardFunc(Keyboard);
-    glutTimerFunc(30, Timer, 0);
+    StartTimer();   // 에셋을 다 올릴 때까지
 
     glutMainLoop();
     return 0;
@@ -0,0 +1,12 @@
+#version 330 core
+
+in vec2 vTex;
+in vec4 vColor;
+out vec4 FragColor;
+
+uniform sampler2D uAtlas;              // ۸ Ʋ (R ä = )
+
+void main()
+{
+    FragColor = vec4(vColor.rgb, vColor.a * texture(uAtlas, vTex).r);
+}
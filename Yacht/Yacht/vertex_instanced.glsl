@@ -0,0 +1,15 @@
+#version 330 core
+
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec2 aTex;
+layout(location = 2) in mat4 aModel;   // νϽ   (location 2~5)
+
+uniform mat4 uViewProj;
+
+out vec2 vTex;
+
+void main()
+{
+    vTex = aTex;
+    gl_Position = uViewProj * aModel * vec4(aPos, 1.0);
+}
@@ -0,0 +1,17 @@
+#version 330 core
+
+layout(location = 0) in vec2 aPos;     // â ȼ ǥ
+layout(location = 1) in vec2 aTex;     // Ʋ ǥ
+layout(location = 2) in vec4 aColor;
+
+uniform vec2 uScreen;                  // â ũ (ȼ)
+
+out vec2 vTex;
+out vec4 vColor;
+
+void main()
+{
+    vTex = aTex;
+    vColor = aColor;
+    gl_Position = vec4(aPos / uScreen * 2.0 - 1.0, 0.0, 1.0);
+}